@@ -16,7 +16,7 @@
 // Return:  None.
 // Throws:  None.
 //--
-CMICmdArgContext::CMICmdArgContext() {}
+CMICmdArgContext::CMICmdArgContext() : m_nArgFirst(0) {}
 
 //++
 // Details: CMICmdArgContext constructor.
@@ -27,7 +27,9 @@ CMICmdArgContext::CMICmdArgContext() {}
 // Throws:  None.
 //--
 CMICmdArgContext::CMICmdArgContext(const CMIUtilString &vrCmdLineArgsRaw)
-    : m_strCmdArgsAndOptions(vrCmdLineArgsRaw) {}
+    : m_nArgFirst(0) {
+  Tokenize(vrCmdLineArgsRaw);
+}
 
 //++
 // Details: CMICmdArgContext destructor.
@@ -38,16 +40,69 @@ CMICmdArgContext::CMICmdArgContext(const CMIUtilString &vrCmdLineArgsRaw)
 //--
 CMICmdArgContext::~CMICmdArgContext() {}
 
+//++
+// Details: Split the options text into arguments delimited by spaces. Spaces
+//          inside quotes do not delimit, a quote escaped by a '\' does not
+//          open or close quoted text. An unmatched quote leaves *this context
+//          with no arguments.
+// Type:    Method.
+// Args:    vrText  - (R) The text description of the arguments options.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgContext::Tokenize(const CMIUtilString &vrText) {
+  const char *const pText = vrText.c_str();
+  const size_t nLen = vrText.length();
+
+  size_t nPos = 0;
+  while (nPos < nLen) {
+    if (pText[nPos] == ' ') {
+      ++nPos;
+      continue;
+    }
+
+    const size_t nStart = nPos;
+    bool bInQuotes = false;
+    for (; nPos < nLen; ++nPos) {
+      const char c = pText[nPos];
+      if ((c == ' ') && !bInQuotes)
+        break;
+      if (c == '"')
+        bInQuotes = !bInQuotes;
+      else if ((c == '\\') && (nPos + 1 < nLen) && (pText[nPos + 1] != ' '))
+        ++nPos;
+    }
+    if (bInQuotes) {
+      m_vecArgs.clear();
+      m_strCmdArgsUnmatched = vrText.Trim();
+      return;
+    }
+
+    m_vecArgs.emplace_back(vrText.substr(nStart, nPos - nStart));
+  }
+}
+
 //++
 // Details: Retrieve the remainder of the command's argument options left to
 // parse.
 // Type:    Method.
 // Args:    None.
-// Return:  CMIUtilString & - Argument options text.
+// Return:  CMIUtilString - Argument options text, the arguments separated by
+//                          a space.
 // Throws:  None.
 //--
-const CMIUtilString &CMICmdArgContext::GetArgsLeftToParse() const {
-  return m_strCmdArgsAndOptions;
+CMIUtilString CMICmdArgContext::GetArgsLeftToParse() const {
+  if (!m_strCmdArgsUnmatched.empty())
+    return m_strCmdArgsUnmatched;
+
+  CMIUtilString strArgs;
+  for (size_t i = m_nArgFirst; i < m_vecArgs.size(); ++i) {
+    if (i != m_nArgFirst)
+      strArgs += ' ';
+    strArgs += m_vecArgs[i];
+  }
+
+  return strArgs;
 }
 
 //++
@@ -59,122 +114,29 @@ const CMIUtilString &CMICmdArgContext::GetArgsLeftToParse() const {
 // Throws:  None.
 //--
 bool CMICmdArgContext::IsEmpty() const {
-  return m_strCmdArgsAndOptions.empty();
+  return (m_nArgFirst == m_vecArgs.size()) && m_strCmdArgsUnmatched.empty();
 }
 
 //++
-// Details: Remove the argument from the options text and any space after the
-// argument
-//          if applicable.
+// Details: Remove the argument at the Nth position along in the arguments
+//          left to parse. Removing the first argument costs nothing, the
+//          others move the arguments after it.
 // Type:    Method.
-// Args:    vArg    - (R) The name of the argument.
+// Args:    vnIndex - (R) Position of the argument, 0 = the first left.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdArgContext::RemoveArg(const CMIUtilString &vArg) {
-  if (vArg.empty())
-    return MIstatus::success;
-
-  const size_t nLen = vArg.length();
-  const size_t nLenCntxt = m_strCmdArgsAndOptions.length();
-  if (nLen > nLenCntxt)
+bool CMICmdArgContext::RemoveArgAtPos(const size_t vnIndex) {
+  if (vnIndex >= GetNumberArgsPresent())
     return MIstatus::failure;
 
-  size_t nExtraSpace = 0;
-  size_t nPos = m_strCmdArgsAndOptions.find(vArg);
-  while (1) {
-    if (nPos == std::string::npos)
-      return MIstatus::success;
-
-    bool bPass1 = false;
-    if (nPos != 0) {
-      if (m_strCmdArgsAndOptions[nPos - 1] == ' ')
-        bPass1 = true;
-    } else
-      bPass1 = true;
-
-    const size_t nEnd = nPos + nLen;
-
-    if (bPass1) {
-      bool bPass2 = false;
-      if (nEnd < nLenCntxt) {
-        if (m_strCmdArgsAndOptions[nEnd] == ' ') {
-          bPass2 = true;
-          nExtraSpace = 1;
-        }
-      } else
-        bPass2 = true;
-
-      if (bPass2)
-        break;
-    }
-
-    nPos = m_strCmdArgsAndOptions.find(vArg, nEnd);
-  }
-
-  const size_t nPosEnd = nLen + nExtraSpace;
-  m_strCmdArgsAndOptions = m_strCmdArgsAndOptions.replace(nPos, nPosEnd, "");
-  m_strCmdArgsAndOptions = m_strCmdArgsAndOptions.Trim();
-
-  return MIstatus::success;
-}
-
-//++
-// Details: Remove the argument at the Nth word position along in the context
-// string.
-//          Any space after the argument is removed if applicable. A search is
-//          not
-//          performed as there may be more than one vArg with the same 'name' in
-//          the
-//          context string.
-// Type:    Method.
-// Args:    vArg        - (R) The name of the argument.
-//          nArgIndex   - (R) The word count position to which to remove the
-//          vArg word.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
-// Throws:  None.
-//--
-bool CMICmdArgContext::RemoveArgAtPos(const CMIUtilString &vArg,
-                                      size_t nArgIndex) {
-  size_t nWordIndex = 0;
-  CMIUtilString strBuildContextUp;
-  const CMIUtilString::VecString_t vecWords(GetArgs());
-  const bool bSpaceRequired(GetNumberArgsPresent() > 2);
-
-  CMIUtilString::VecString_t::const_iterator it = vecWords.begin();
-  const CMIUtilString::VecString_t::const_iterator itEnd = vecWords.end();
-  while (it != itEnd) {
-    const CMIUtilString &rWord(*it);
-    if (nWordIndex++ != nArgIndex) {
-      // Single words
-      strBuildContextUp += rWord;
-      if (bSpaceRequired)
-        strBuildContextUp += " ";
-    } else {
-      // If quoted loose quoted text
-      if (++it != itEnd) {
-        CMIUtilString words = rWord;
-        while (vArg != words) {
-          if (bSpaceRequired)
-            words += " ";
-          words += *it;
-          if (++it == itEnd)
-            break;
-        }
-        if (it != itEnd)
-          --it;
-      }
-    }
-
-    // Next
-    if (it != itEnd)
-      ++it;
+  if (vnIndex == 0) {
+    ++m_nArgFirst;
+    return MIstatus::success;
   }
 
-  m_strCmdArgsAndOptions = strBuildContextUp;
-  m_strCmdArgsAndOptions = m_strCmdArgsAndOptions.Trim();
+  m_vecArgs.erase(m_vecArgs.begin() + (m_nArgFirst + vnIndex));
 
   return MIstatus::success;
 }
@@ -188,34 +150,18 @@ bool CMICmdArgContext::RemoveArgAtPos(const CMIUtilString &vArg,
 // Throws:  None.
 //--
 size_t CMICmdArgContext::GetNumberArgsPresent() const {
-  CMIUtilString::VecString_t vecOptions;
-  return m_strCmdArgsAndOptions.SplitConsiderQuotes(" ", vecOptions);
+  return m_vecArgs.size() - m_nArgFirst;
 }
 
 //++
-// Details: Retrieve all the arguments or options remaining in *this context.
+// Details: Retrieve the argument at the Nth position along in the arguments
+//          left to parse.
 // Type:    Method.
-// Args:    None.
-// Return:  MIUtilString::VecString_t   - List of args remaining.
+// Args:    vnIndex - (R) Position of the argument, 0 = the first left. Must be
+//                        less than GetNumberArgsPresent().
+// Return:  CMIUtilString & - The argument's text.
 // Throws:  None.
 //--
-CMIUtilString::VecString_t CMICmdArgContext::GetArgs() const {
-  CMIUtilString::VecString_t vecOptions;
-  m_strCmdArgsAndOptions.SplitConsiderQuotes(" ", vecOptions);
-  return vecOptions;
-}
-
-//++
-// Details: Copy assignment operator.
-// Type:    Method.
-// Args:    vOther  - (R) The variable to copy from.
-// Return:  CMIUtilString & - this object.
-// Throws:  None.
-//--
-CMICmdArgContext &CMICmdArgContext::operator=(const CMICmdArgContext &vOther) {
-  if (this != &vOther) {
-    m_strCmdArgsAndOptions = vOther.m_strCmdArgsAndOptions;
-  }
-
-  return *this;
+const CMIUtilString &CMICmdArgContext::GetArg(const size_t vnIndex) const {
+  return m_vecArgs[m_nArgFirst + vnIndex];
 }
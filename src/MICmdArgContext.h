@@ -15,6 +15,13 @@
 //============================================================================
 // Details: MI common code class. Command arguments and options string. Holds
 //          the context string.
+//          The string is split into its arguments once, when *this context is
+//          created, honouring quotes the way
+//          CMIUtilString::SplitConsiderQuotes() does. Argument objects look
+//          at the arguments left to parse by index and remove those they
+//          consume by index so parsing a command's options is one pass over
+//          its text. A context with an unmatched quote has no arguments but
+//          is not empty.
 //          Based on the Interpreter pattern.
 //--
 class CMICmdArgContext {
@@ -23,21 +30,26 @@ public:
   /* ctor */ CMICmdArgContext();
   /* ctor */ CMICmdArgContext(const CMIUtilString &vrCmdLineArgsRaw);
   //
-  const CMIUtilString &GetArgsLeftToParse() const;
+  CMIUtilString GetArgsLeftToParse() const;
   size_t GetNumberArgsPresent() const;
-  CMIUtilString::VecString_t GetArgs() const;
+  const CMIUtilString &GetArg(const size_t vnIndex) const;
   bool IsEmpty() const;
-  bool RemoveArg(const CMIUtilString &vArg);
-  bool RemoveArgAtPos(const CMIUtilString &vArg, size_t nArgIndex);
-  //
-  CMICmdArgContext &operator=(const CMICmdArgContext &vOther);
+  bool RemoveArgAtPos(const size_t vnIndex);
 
   // Overridden:
 public:
   // From CMIUtilString
   /* dtor */ virtual ~CMICmdArgContext();
 
+  // Methods:
+private:
+  void Tokenize(const CMIUtilString &vrText);
+
   // Attributes:
 private:
-  CMIUtilString m_strCmdArgsAndOptions;
+  CMIUtilString::VecString_t m_vecArgs; // The arguments, those before
+                                        // m_nArgFirst have been consumed
+  size_t m_nArgFirst;     // Index of the first argument left to parse
+  CMIUtilString m_strCmdArgsUnmatched; // The options text when it has an
+                                       // unmatched quote, empty otherwise
 };
@@ -10,6 +10,10 @@
 #include "MICmdArgSet.h"
 #include "MICmdArgValBase.h"
 #include "MICmnLog.h"
+#include "MICmnMIValueConst.h"
+#include "MICmnMIValueList.h"
+#include "MICmnMIValueResult.h"
+#include "MICmnMIValueTuple.h"
 #include "MICmnResources.h"
 
 //++
@@ -88,6 +92,85 @@ bool CMICmdArgSet::IsArgsPresentButNotHandledByCmd() const {
 //--
 void CMICmdArgSet::Add(CMICmdArgValBase *vArg) { m_setCmdArgs.push_back(vArg); }
 
+//++
+// Details: Forget the results of the last validation so *this container can
+//          validate another command's options. The arguments added stay,
+//          each forgets the value it found.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgSet::Reset() {
+  for (CMICmdArgValBase *pArg : m_setCmdArgs)
+    pArg->Reset();
+
+  m_setCmdArgsThatNotValid.clear();
+  m_setCmdArgsThatAreMissing.clear();
+  m_setCmdArgsNotHandledByCmd.clear();
+  m_setCmdArgsMissingInfo.clear();
+  m_bIsArgsPresentButNotHandledByCmd = false;
+  m_cmdArgContext = CMICmdArgContext();
+}
+
+//++
+// Details: Move the arguments of another container into *this one, replacing
+//          any *this had. The arguments are reset, the other container is
+//          left empty.
+// Type:    Method.
+// Args:    vwrArgSet   - (RW) Container to take the arguments from.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgSet::Take(CMICmdArgSet &vwrArgSet) {
+  Destroy();
+  m_setCmdArgs.swap(vwrArgSet.m_setCmdArgs);
+  vwrArgSet.Destroy();
+  Reset();
+}
+
+//++
+// Details: Retrieve the arguments added to *this container, in the order they
+//          are parsed.
+// Type:    Method.
+// Args:    None.
+// Return:  SetCmdArgs_t & - The arguments.
+// Throws:  None.
+//--
+const CMICmdArgSet::SetCmdArgs_t &CMICmdArgSet::GetArgs() const {
+  return m_setCmdArgs;
+}
+
+//++
+// Details: Form the MI list of the arguments added to *this container, as
+//          given by the -info-gdb-mi-command command. Each argument is given
+//          as {name="...",kind="...",mandatory="true|false"} with
+//          value-kind="..." added for the arguments that take values of
+//          another kind.
+// Type:    Method.
+// Args:    vwrMiValueList  - (W) List to add the arguments to.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgSet::GetArgsMIList(CMICmnMIValueList &vwrMiValueList) const {
+  for (const CMICmdArgValBase *pArg : m_setCmdArgs) {
+    const CMICmnMIValueConst miValueConstName(pArg->GetName());
+    CMICmnMIValueTuple miValueTuple(
+        CMICmnMIValueResult("name", miValueConstName));
+    const CMICmnMIValueConst miValueConstKind(pArg->GetKind());
+    miValueTuple.Add(CMICmnMIValueResult("kind", miValueConstKind));
+    const CMICmnMIValueConst miValueConstMandatory(
+        pArg->GetIsMandatory() ? "true" : "false");
+    miValueTuple.Add(CMICmnMIValueResult("mandatory", miValueConstMandatory));
+    if (pArg->GetValueKind() != nullptr) {
+      const CMICmnMIValueConst miValueConstValueKind(pArg->GetValueKind());
+      miValueTuple.Add(
+          CMICmnMIValueResult("value-kind", miValueConstValueKind));
+    }
+    vwrMiValueList.Add(miValueTuple);
+  }
+}
+
 //++
 // Details: After validating an options line of text (the context) and there is
 // a failure,
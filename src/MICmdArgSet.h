@@ -15,6 +15,7 @@
 
 // Declarations:
 class CMICmdArgValBase;
+class CMICmnMIValueList;
 
 //++
 //============================================================================
@@ -61,7 +62,11 @@ public:
   CMICmdArgSet();
 
   void Add(CMICmdArgValBase *vArg);
+  void Reset();
+  void Take(CMICmdArgSet &vwrArgSet);
   bool GetArg(const CMIUtilString &vArgName, CMICmdArgValBase *&vpArg) const;
+  const SetCmdArgs_t &GetArgs() const;
+  void GetArgsMIList(CMICmnMIValueList &vwrMiValueList) const;
   const SetCmdArgs_t &GetArgsThatAreMissing() const;
   const SetCmdArgs_t &GetArgsThatInvalid() const;
   size_t GetCount() const;
@@ -110,6 +110,42 @@ bool CMICmdArgValBase::GetValid() const { return m_bValid; }
 //--
 bool CMICmdArgValBase::GetIsMandatory() const { return m_bMandatory; }
 
+//++
+// Details: Forget what the last parse found so *this argument can parse
+//          another command's options. The argument's name and what it looks
+//          for stay the same.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgValBase::Reset() {
+  m_bFound = false;
+  m_bValid = false;
+  m_bIsMissingOptions = false;
+}
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for,
+//          as reported by the -info-gdb-mi-command command.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValBase::GetKind() const { return "argument"; }
+
+//++
+// Details: Retrieve the name of the kind of values an option or list argument
+//          takes.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  const char * - Kind of value, nullptr = *this argument takes no
+//                         values.
+// Throws:  None.
+//--
+const char *CMICmdArgValBase::GetValueKind() const { return nullptr; }
+
 //++
 // Details: Parse the command's argument options string and try to extract the
 // value *this
@@ -40,6 +40,9 @@ public:
 
   // Overrideable:
   ~CMICmdArgValBase() override = default;
+  virtual void Reset();
+  virtual const char *GetKind() const;
+  virtual const char *GetValueKind() const;
 
   // Overridden:
   // From CMICmdArgSet::IArg
@@ -78,6 +81,7 @@ public:
 
   // Overrideable:
   ~CMICmdArgValBaseTemplate() override = default;
+  void Reset() override;
 
   // Attributes:
 protected:
@@ -113,3 +117,16 @@ CMICmdArgValBaseTemplate<T>::CMICmdArgValBaseTemplate(
 template <class T> const T &CMICmdArgValBaseTemplate<T>::GetValue() const {
   return m_argValue;
 }
+
+//++
+// Details: Forget the value found by the last parse so *this argument can
+//          parse another command's options.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+template <class T> void CMICmdArgValBaseTemplate<T>::Reset() {
+  CMICmdArgValBase::Reset();
+  m_argValue = T();
+}
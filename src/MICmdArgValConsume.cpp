@@ -57,20 +57,15 @@ bool CMICmdArgValConsume::Validate(CMICmdArgContext &vwArgContext) {
 
   // Consume the optional file, line, linenum arguments till the mode '--'
   // argument
-  const CMIUtilString::VecString_t vecOptions(vwArgContext.GetArgs());
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rTxt(*it);
-
-    if (rTxt == "--") {
+  const size_t nArgs = vwArgContext.GetNumberArgsPresent();
+  for (size_t i = 0; i < nArgs; ++i) {
+    if (vwArgContext.GetArg(i) == "--") {
       m_bFound = true;
       m_bValid = true;
-      if (!vwArgContext.RemoveArg(rTxt))
+      if (!vwArgContext.RemoveArgAtPos(i))
         return MIstatus::failure;
       return MIstatus::success;
     }
-    // Next
-    ++it;
   }
 
   return MIstatus::failure;
@@ -86,3 +81,12 @@ bool CMICmdArgValConsume::Validate(CMICmdArgContext &vwArgContext) {
 // Throws:  None.
 //--
 bool CMICmdArgValConsume::IsOk() const { return true; }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValConsume::GetKind() const { return "consume"; }
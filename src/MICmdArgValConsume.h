@@ -48,6 +48,7 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValConsume() override;
+  const char *GetKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vwArgContext) override;
 };
@@ -61,12 +61,12 @@ bool CMICmdArgValFile::Validate(CMICmdArgContext &vwArgContext) {
   // The GDB/MI spec suggests there is only parameter
 
   if (vwArgContext.GetNumberArgsPresent() == 1) {
-    const CMIUtilString &rFile(vwArgContext.GetArgsLeftToParse());
+    const CMIUtilString &rFile(vwArgContext.GetArg(0));
     if (IsFilePath(rFile)) {
       m_bFound = true;
       m_bValid = true;
       m_argValue = rFile.Trim('"');
-      vwArgContext.RemoveArg(rFile);
+      vwArgContext.RemoveArgAtPos(0);
       return MIstatus::success;
     } else
       return MIstatus::failure;
@@ -74,23 +74,16 @@ bool CMICmdArgValFile::Validate(CMICmdArgContext &vwArgContext) {
 
   // In reality there are more than one option,  if so the file option
   // is the last one (don't handle that here - find the best looking one)
-  const CMIUtilString::VecString_t vecOptions(vwArgContext.GetArgs());
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rTxt(*it);
+  const size_t nArgs = vwArgContext.GetNumberArgsPresent();
+  for (size_t i = 0; i < nArgs; ++i) {
+    const CMIUtilString &rTxt(vwArgContext.GetArg(i));
     if (IsFilePath(rTxt)) {
       m_bFound = true;
-
-      if (vwArgContext.RemoveArg(rTxt)) {
-        m_bValid = true;
-        m_argValue = rTxt.Trim('"');
-        return MIstatus::success;
-      } else
-        return MIstatus::success;
+      m_bValid = true;
+      m_argValue = rTxt.Trim('"');
+      vwArgContext.RemoveArgAtPos(i);
+      return MIstatus::success;
     }
-
-    // Next
-    ++it;
   }
 
   return MIstatus::failure;
@@ -176,3 +169,12 @@ bool CMICmdArgValFile::IsValidChars(const CMIUtilString &vrText) const {
 
   return true;
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValFile::GetKind() const { return "file"; }
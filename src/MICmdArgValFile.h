@@ -38,6 +38,7 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValFile() override;
+  const char *GetKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vwArgContext) override;
 
@@ -77,6 +77,59 @@ CMICmdArgValListBase::~CMICmdArgValListBase() {
   Destroy();
 }
 
+//++
+// Details: Delete the argument objects the last parse found so *this argument
+//          can parse another command's options.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgValListBase::Reset() {
+  Destroy();
+  CMICmdArgValBaseTemplate::Reset();
+}
+
+//++
+// Details: Retrieve the name of a type of argument, as reported by the
+//          -info-gdb-mi-command command.
+// Type:    Static method.
+// Args:    veType  - (R) The type of argument.
+// Return:  const char * - Type name.
+// Throws:  None.
+//--
+const char *
+CMICmdArgValListBase::GetArgValTypeName(const ArgValType_e veType) {
+  switch (veType) {
+  case eArgValType_File:
+    return "file";
+  case eArgValType_Consume:
+    return "consume";
+  case eArgValType_Number:
+    return "number";
+  case eArgValType_OptionLong:
+    return "long-option";
+  case eArgValType_OptionShort:
+    return "short-option";
+  case eArgValType_String:
+    return "string";
+  case eArgValType_StringQuoted:
+    return "quoted-string";
+  case eArgValType_StringQuotedNumber:
+    return "quoted-string-or-number";
+  case eArgValType_StringQuotedNumberPath:
+    return "quoted-string-number-or-path";
+  case eArgValType_StringAnything:
+    return "text";
+  case eArgValType_ThreadGrp:
+    return "thread-group";
+  case eArgValType_count:
+  case eArgValType_invalid:
+    break;
+  }
+  return "invalid";
+}
+
 //++
 // Details: Tear down resources used by *this object.
 // Type:    Method.
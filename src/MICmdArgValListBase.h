@@ -79,10 +79,15 @@ public:
                                   const bool vbHandleByCmd,
                                   const ArgValType_e veType);
 
+  // Statics:
+public:
+  static const char *GetArgValTypeName(const ArgValType_e veType);
+
   // Overridden:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValListBase() override;
+  void Reset() override;
 
   // Methods:
 protected:
@@ -72,11 +72,12 @@ bool CMICmdArgValListOfN::Validate(CMICmdArgContext &vwArgContext) {
   if (vwArgContext.IsEmpty())
     return m_bMandatory ? MIstatus::failure : MIstatus::success;
 
-  const CMIUtilString &rArg(vwArgContext.GetArgsLeftToParse());
-  if (IsListOfN(rArg) && CreateList(rArg)) {
+  if (CreateList(vwArgContext)) {
     m_bFound = true;
     m_bValid = true;
-    vwArgContext.RemoveArg(rArg);
+    const size_t nArgs = vwArgContext.GetNumberArgsPresent();
+    for (size_t i = 0; i < nArgs; ++i)
+      vwArgContext.RemoveArgAtPos(0);
     return MIstatus::success;
   } else
     return MIstatus::failure;
@@ -85,71 +86,29 @@ bool CMICmdArgValListOfN::Validate(CMICmdArgContext &vwArgContext) {
 //++
 // Details: Create list of argument objects each holding a value extract from
 // the command
-//          options line.
+//          options line, one for each of the arguments left to parse.
 // Type:    Method.
-// Args:    vrTxt   - (R) Some options text.
+// Args:    vrArgContext    - (R) The command's argument options string.
 // Return:  bool -  True = yes valid arg, false = no.
 // Throws:  None.
 //--
-bool CMICmdArgValListOfN::CreateList(const CMIUtilString &vrTxt) {
-  CMIUtilString::VecString_t vecOptions;
-  if ((m_eArgType == eArgValType_StringQuoted) ||
-      (m_eArgType == eArgValType_StringQuotedNumber) ||
-      (m_eArgType == eArgValType_StringQuotedNumberPath) ||
-      (m_eArgType == eArgValType_StringAnything)) {
-    if (vrTxt.SplitConsiderQuotes(" ", vecOptions) == 0)
-      return MIstatus::failure;
-  } else if (vrTxt.Split(" ", vecOptions) == 0)
+bool CMICmdArgValListOfN::CreateList(const CMICmdArgContext &vrArgContext) {
+  const size_t nArgs = vrArgContext.GetNumberArgsPresent();
+  if (nArgs == 0)
     return MIstatus::failure;
 
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rOption = *it;
-    CMICmdArgValBase *pOption = CreationObj(rOption, m_eArgType);
+  for (size_t i = 0; i < nArgs; ++i) {
+    CMICmdArgValBase *pOption =
+        CreationObj(vrArgContext.GetArg(i), m_eArgType);
     if (pOption != nullptr)
       m_argValue.push_back(pOption);
     else
       return MIstatus::failure;
-
-    // Next
-    ++it;
   }
 
   return MIstatus::success;
 }
 
-//++
-// Details: Examine the string and determine if it is a valid string type
-// argument.
-// Type:    Method.
-// Args:    vrTxt   - (R) Some text.
-// Return:  bool -  True = yes valid arg, false = no.
-// Throws:  None.
-//--
-bool CMICmdArgValListOfN::IsListOfN(const CMIUtilString &vrTxt) const {
-  CMIUtilString::VecString_t vecOptions;
-  if ((m_eArgType == eArgValType_StringQuoted) ||
-      (m_eArgType == eArgValType_StringQuotedNumber) ||
-      (m_eArgType == eArgValType_StringQuotedNumberPath) ||
-      (m_eArgType == eArgValType_StringAnything)) {
-    if (vrTxt.SplitConsiderQuotes(" ", vecOptions) == 0)
-      return false;
-  } else if (vrTxt.Split(" ", vecOptions) == 0)
-    return false;
-
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rOption = *it;
-    if (!IsExpectedCorrectType(rOption, m_eArgType))
-      break;
-
-    // Next
-    ++it;
-  }
-
-  return true;
-}
-
 //++
 // Details: Retrieve the list of CMICmdArgValBase derived option objects found
 // following
@@ -165,3 +124,23 @@ const CMICmdArgValListBase::VecArgObjPtr_t &
 CMICmdArgValListOfN::GetExpectedOptions() const {
   return m_argValue;
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValListOfN::GetKind() const { return "list"; }
+
+//++
+// Details: Retrieve the name of the kind of values *this list holds.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of value.
+// Throws:  None.
+//--
+const char *CMICmdArgValListOfN::GetValueKind() const {
+  return GetArgValTypeName(m_eArgType);
+}
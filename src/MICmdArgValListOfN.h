@@ -51,13 +51,14 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValListOfN() override;
+  const char *GetKind() const override;
+  const char *GetValueKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vArgContext) override;
 
   // Methods:
 private:
-  bool IsListOfN(const CMIUtilString &vrTxt) const;
-  bool CreateList(const CMIUtilString &vrTxt);
+  bool CreateList(const CMICmdArgContext &vrArgContext);
 };
 
 //++
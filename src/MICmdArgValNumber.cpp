@@ -64,35 +64,28 @@ bool CMICmdArgValNumber::Validate(CMICmdArgContext &vwArgContext) {
     return m_bMandatory ? MIstatus::failure : MIstatus::success;
 
   if (vwArgContext.GetNumberArgsPresent() == 1) {
-    const CMIUtilString &rArg(vwArgContext.GetArgsLeftToParse());
+    const CMIUtilString &rArg(vwArgContext.GetArg(0));
     if (IsArgNumber(rArg) && ExtractNumber(rArg)) {
       m_bFound = true;
       m_bValid = true;
       m_argValue = GetNumber();
-      vwArgContext.RemoveArg(rArg);
+      vwArgContext.RemoveArgAtPos(0);
       return MIstatus::success;
     } else
       return MIstatus::failure;
   }
 
   // More than one option...
-  const CMIUtilString::VecString_t vecOptions(vwArgContext.GetArgs());
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rArg(*it);
+  const size_t nArgs = vwArgContext.GetNumberArgsPresent();
+  for (size_t i = 0; i < nArgs; ++i) {
+    const CMIUtilString &rArg(vwArgContext.GetArg(i));
     if (IsArgNumber(rArg) && ExtractNumber(rArg)) {
       m_bFound = true;
-
-      if (vwArgContext.RemoveArg(rArg)) {
-        m_bValid = true;
-        m_argValue = GetNumber();
-        return MIstatus::success;
-      } else
-        return MIstatus::failure;
+      m_bValid = true;
+      m_argValue = GetNumber();
+      vwArgContext.RemoveArgAtPos(i);
+      return MIstatus::success;
     }
-
-    // Next
-    ++it;
   }
 
   return MIstatus::failure;
@@ -152,3 +145,12 @@ bool CMICmdArgValNumber::ExtractNumber(const CMIUtilString &vrTxt) {
 // Throws:  None.
 //--
 MIint64 CMICmdArgValNumber::GetNumber() const { return m_nNumber; }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValNumber::GetKind() const { return "number"; }
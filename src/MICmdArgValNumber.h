@@ -54,6 +54,7 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValNumber() override;
+  const char *GetKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vwArgContext) override;
 
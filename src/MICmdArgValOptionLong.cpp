@@ -108,11 +108,11 @@ bool CMICmdArgValOptionLong::Validate(CMICmdArgContext &vwArgContext) {
     return m_bMandatory ? MIstatus::failure : MIstatus::success;
 
   if (vwArgContext.GetNumberArgsPresent() == 1) {
-    const CMIUtilString &rArg(vwArgContext.GetArgsLeftToParse());
+    const CMIUtilString &rArg(vwArgContext.GetArg(0));
     if (IsArgLongOption(rArg) && ArgNameMatch(rArg)) {
       m_bFound = true;
 
-      if (!vwArgContext.RemoveArg(rArg))
+      if (!vwArgContext.RemoveArgAtPos(0))
         return MIstatus::failure;
 
       if (m_nExpectingNOptions == 0) {
@@ -127,15 +127,13 @@ bool CMICmdArgValOptionLong::Validate(CMICmdArgContext &vwArgContext) {
   }
 
   // More than one option...
-  MIuint nArgIndex = 0;
-  const CMIUtilString::VecString_t vecOptions(vwArgContext.GetArgs());
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rArg(*it);
+  const size_t nArgs = vwArgContext.GetNumberArgsPresent();
+  for (size_t nArgIndex = 0; nArgIndex < nArgs; ++nArgIndex) {
+    const CMIUtilString &rArg(vwArgContext.GetArg(nArgIndex));
     if (IsArgOptionCorrect(rArg) && ArgNameMatch(rArg)) {
       m_bFound = true;
 
-      if (!vwArgContext.RemoveArg(rArg))
+      if (!vwArgContext.RemoveArgAtPos(nArgIndex))
         return MIstatus::failure;
 
       if (m_nExpectingNOptions != 0) {
@@ -151,10 +149,6 @@ bool CMICmdArgValOptionLong::Validate(CMICmdArgContext &vwArgContext) {
         return MIstatus::success;
       }
     }
-
-    // Next
-    ++it;
-    ++nArgIndex;
   }
 
   return MIstatus::failure;
@@ -175,47 +169,24 @@ bool CMICmdArgValOptionLong::Validate(CMICmdArgContext &vwArgContext) {
 // Throws:  None.
 //--
 bool CMICmdArgValOptionLong::ExtractExpectedOptions(CMICmdArgContext &vrwTxt,
-                                                    const MIuint nArgIndex) {
-  CMIUtilString::VecString_t vecOptions = vrwTxt.GetArgs();
-  if (vecOptions.size() == 0)
-    return MIstatus::failure;
-
-  MIuint nArgIndexCnt = 0;
-  MIuint nTypeCnt = 0;
-  MIuint nTypeCnt2 = 0;
-  MIuint nFoundNOptionsCnt = 0;
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    // Move to the Nth argument position from left before do validation/checking
-    if (nArgIndexCnt++ == nArgIndex) {
-      nTypeCnt++;
-      const CMIUtilString &rOption(*it);
-      if (IsExpectedCorrectType(rOption, m_eExpectingOptionType)) {
-        nTypeCnt2++;
-        CMICmdArgValBase *pOptionObj =
-            CreationObj(rOption, m_eExpectingOptionType);
-        if ((pOptionObj != nullptr) &&
-            vrwTxt.RemoveArgAtPos(rOption, nArgIndex)) {
-          nFoundNOptionsCnt++;
-          m_vecArgsExpected.push_back(pOptionObj);
-        }
-      }
-
-      // Is the sequence 'options' of same type broken. Expecting the same type
-      // until the
-      // next argument.
-      if (nTypeCnt != nTypeCnt2)
-        return MIstatus::failure;
+                                                    const size_t nArgIndex) {
+  // The options follow *this argument, each one removed moves the next one to
+  // the same position. Expecting the same type until the last option.
+  for (MIuint i = 0; i < m_nExpectingNOptions; ++i) {
+    if (nArgIndex >= vrwTxt.GetNumberArgsPresent())
+      return MIstatus::failure;
 
-      if (nFoundNOptionsCnt == m_nExpectingNOptions)
-        return MIstatus::success;
-    }
+    const CMIUtilString &rOption(vrwTxt.GetArg(nArgIndex));
+    if (!IsExpectedCorrectType(rOption, m_eExpectingOptionType))
+      return MIstatus::failure;
 
-    // Next
-    ++it;
+    CMICmdArgValBase *pOptionObj =
+        CreationObj(rOption, m_eExpectingOptionType);
+    if (pOptionObj == nullptr)
+      return MIstatus::failure;
+    m_vecArgsExpected.push_back(pOptionObj);
+    vrwTxt.RemoveArgAtPos(nArgIndex);
   }
-  if (nFoundNOptionsCnt != m_nExpectingNOptions)
-    return MIstatus::failure;
 
   return MIstatus::success;
 }
@@ -289,3 +260,39 @@ const CMICmdArgValListBase::VecArgObjPtr_t &
 CMICmdArgValOptionLong::GetExpectedOptions() const {
   return m_vecArgsExpected;
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValOptionLong::GetKind() const { return "long-option"; }
+
+//++
+// Details: Retrieve the name of the kind of values *this option takes.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of value, nullptr = *this option takes no
+//                         values.
+// Throws:  None.
+//--
+const char *CMICmdArgValOptionLong::GetValueKind() const {
+  if (m_nExpectingNOptions == 0)
+    return nullptr;
+  return GetArgValTypeName(m_eExpectingOptionType);
+}
+
+//++
+// Details: Delete the option values the last parse found so *this argument
+//          can parse another command's options.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdArgValOptionLong::Reset() {
+  Destroy();
+  CMICmdArgValListBase::Reset();
+}
@@ -51,12 +51,16 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValOptionLong() override;
+  const char *GetKind() const override;
+  const char *GetValueKind() const override;
+  void Reset() override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vArgContext) override;
 
   // Methods:
 protected:
-  bool ExtractExpectedOptions(CMICmdArgContext &vrwTxt, const MIuint nArgIndex);
+  bool ExtractExpectedOptions(CMICmdArgContext &vrwTxt,
+                              const size_t nArgIndex);
 
   // Overrideable:
 protected:
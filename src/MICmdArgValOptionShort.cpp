@@ -119,3 +119,12 @@ bool CMICmdArgValOptionShort::ArgNameMatch(const CMIUtilString &vrTxt) const {
   const CMIUtilString strArg = vrTxt.substr(1);
   return (strArg == GetName());
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValOptionShort::GetKind() const { return "short-option"; }
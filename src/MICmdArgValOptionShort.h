@@ -50,6 +50,7 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValOptionShort() override;
+  const char *GetKind() const override;
 
   // Overridden:
 private:
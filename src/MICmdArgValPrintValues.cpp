@@ -59,12 +59,15 @@ bool CMICmdArgValPrintValues::Validate(CMICmdArgContext &vwArgContext) {
   if (vwArgContext.IsEmpty())
     return m_bMandatory ? MIstatus::failure : MIstatus::success;
 
-  const CMIUtilString strArg(vwArgContext.GetArgs()[0]);
-  if (IsArgPrintValues(strArg) && ExtractPrintValues(strArg)) {
+  if (vwArgContext.GetNumberArgsPresent() == 0)
+    return MIstatus::failure;
+
+  const CMIUtilString &rArg(vwArgContext.GetArg(0));
+  if (IsArgPrintValues(rArg) && ExtractPrintValues(rArg)) {
     m_bFound = true;
     m_bValid = true;
     m_argValue = GetPrintValues();
-    vwArgContext.RemoveArg(strArg);
+    vwArgContext.RemoveArgAtPos(0);
     return MIstatus::success;
   }
 
@@ -123,3 +126,12 @@ bool CMICmdArgValPrintValues::ExtractPrintValues(const CMIUtilString &vrTxt) {
 MIuint CMICmdArgValPrintValues::GetPrintValues() const {
   return m_nPrintValues;
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValPrintValues::GetKind() const { return "print-values"; }
@@ -42,6 +42,7 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValPrintValues() override;
+  const char *GetKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vArgContext) override;
 
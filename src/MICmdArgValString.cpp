@@ -10,8 +10,6 @@
 #include "MICmdArgValString.h"
 #include "MICmdArgContext.h"
 
-#include <regex>
-
 //++
 // Details: CMICmdArgValString constructor.
 // Type:    Method.
@@ -139,18 +137,13 @@ bool CMICmdArgValString::Validate(CMICmdArgContext &vrwArgContext) {
 // Throws:  None.
 //--
 bool CMICmdArgValString::ValidateSingleText(CMICmdArgContext &vrwArgContext) {
-  const CMIUtilString::VecString_t vecOptions(vrwArgContext.GetArgs());
-  CMIUtilString::VecString_t::const_iterator it = vecOptions.begin();
-  while (it != vecOptions.end()) {
-    const CMIUtilString &rArg(*it);
-    if (IsStringArg(rArg)) {
+  const size_t nArgs = vrwArgContext.GetNumberArgsPresent();
+  for (size_t i = 0; i < nArgs; ++i) {
+    if (IsStringArg(vrwArgContext.GetArg(i))) {
       m_bFound = true;
 
-      return ConsumeArgument(vrwArgContext, rArg);
+      return ConsumeArgument(vrwArgContext, i);
     }
-
-    // Next
-    ++it;
   }
 
   return MIstatus::failure;
@@ -167,17 +160,15 @@ bool CMICmdArgValString::ValidateSingleText(CMICmdArgContext &vrwArgContext) {
 // Throws:  None.
 //--
 bool CMICmdArgValString::ValidateQuotedText(CMICmdArgContext &vrwArgContext) {
-  const CMIUtilString::VecString_t vecOptions(vrwArgContext.GetArgs());
-  if (vecOptions.size() == 0)
+  if (vrwArgContext.GetNumberArgsPresent() == 0)
     return MIstatus::failure;
 
-  const CMIUtilString &rArg(vecOptions[0]);
-  if (!IsStringArg(rArg))
+  if (!IsStringArg(vrwArgContext.GetArg(0)))
     return MIstatus::failure;
 
   m_bFound = true;
 
-  return ConsumeArgument(vrwArgContext, rArg);
+  return ConsumeArgument(vrwArgContext, 0);
 }
 
 //++
@@ -247,6 +238,25 @@ bool CMICmdArgValString::IsStringArgSingleText(
 //--
 bool CMICmdArgValString::IsStringArgQuotedText(
     const CMIUtilString &vrTxt) const {
-  std::regex quotedText("\\s*\"(.*)\"\\s*");
-  return std::regex_match(vrTxt, quotedText);
+  // Same as matching \s*"(.*)"\s* but without std::regex, which recurses per
+  // character and overflows the stack on long arguments
+  const char *pWhitespace = " \t\n\v\f\r";
+  const size_t nStart = vrTxt.find_first_not_of(pWhitespace);
+  if (nStart == std::string::npos)
+    return false;
+  const size_t nEnd = vrTxt.find_last_not_of(pWhitespace);
+  if ((nEnd == nStart) || (vrTxt[nStart] != '"') || (vrTxt[nEnd] != '"'))
+    return false;
+
+  const size_t nLineEnd = vrTxt.find_first_of("\n\r", nStart);
+  return (nLineEnd == std::string::npos) || (nLineEnd > nEnd);
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValString::GetKind() const { return "string"; }
@@ -49,6 +49,7 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValString() override;
+  const char *GetKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vrwArgContext) override;
 
@@ -23,15 +23,10 @@ bool CMICmdArgValText::Validate(CMICmdArgContext &vwrArgContext) {
   if (vwrArgContext.IsEmpty())
     return m_bMandatory ? MIstatus::failure : MIstatus::success;
 
-  auto &&args = vwrArgContext.GetArgs();
-
-  auto it = args.begin();
-  if (it == args.end())
+  if (vwrArgContext.GetNumberArgsPresent() == 0)
     return MIstatus::failure;
 
-  const CMIUtilString &rExpr(*it);
-
-  return ConsumeArgument(vwrArgContext, rExpr);
+  return ConsumeArgument(vwrArgContext, 0);
 }
 
 //++
@@ -39,17 +34,19 @@ bool CMICmdArgValText::Validate(CMICmdArgContext &vwrArgContext) {
 //          value of this argument.
 // Type:    Overridden.
 // Args:    vwArgContext    - (R) The command's argument options string.
-//          vrArg           - (R) The argument to consume
+//          vnArgIndex      - (R) Position of the argument to consume in the
+//                                arguments left to parse.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
 bool CMICmdArgValText::ConsumeArgument(CMICmdArgContext &vwrArgContext,
-                                       const CMIUtilString &vrArg) {
+                                       const size_t vnArgIndex) {
   // We must do it before removing because reference can become invalid
-  auto &&rArgValue = vrArg.Trim().Trim('"').StripSlashes();
+  auto &&rArgValue =
+      vwrArgContext.GetArg(vnArgIndex).Trim().Trim('"').StripSlashes();
 
-  if (vwrArgContext.RemoveArg(vrArg)) {
+  if (vwrArgContext.RemoveArgAtPos(vnArgIndex)) {
     m_bValid = true;
     m_argValue = rArgValue;
     return MIstatus::success;
@@ -57,3 +54,12 @@ bool CMICmdArgValText::ConsumeArgument(CMICmdArgContext &vwrArgContext,
 
   return MIstatus::failure;
 }
+
+//++
+// Details: Retrieve the name of the kind of argument *this argument looks for.
+// Type:    Overridden.
+// Args:    None.
+// Return:  const char * - Kind of argument.
+// Throws:  None.
+//--
+const char *CMICmdArgValText::GetKind() const { return "text"; }
@@ -34,11 +34,12 @@ public:
 public:
   // From CMICmdArgValBase
   /* dtor */ ~CMICmdArgValText() override = default;
+  const char *GetKind() const override;
   // From CMICmdArgSet::IArg
   bool Validate(CMICmdArgContext &vwrArgContext) override;
 
   // Utilities:
 protected:
   bool ConsumeArgument(CMICmdArgContext &vwrArgContext,
-                       const CMIUtilString &vrArg);
+                       const size_t vnArgIndex);
 };
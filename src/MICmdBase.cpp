@@ -21,9 +21,10 @@
 // Throws:  None.
 //--
 CMICmdBase::CMICmdBase()
-    : m_pSelfCreatorFn(nullptr),
+    : m_pSelfCreatorFn(nullptr), m_bReusable(false),
       m_rLLDBDebugSessionInfo(CMICmnLLDBDebugSessionInfo::Instance()),
-      m_bHasResultRecordExtra(false), m_constStrArgThreadGroup("thread-group"),
+      m_bHasResultRecordExtra(false), m_bArgsAdded(false),
+      m_constStrArgThreadGroup("thread-group"),
       m_constStrArgThread("thread"), m_constStrArgFrame("frame"),
       m_constStrArgConsume("--"), m_ThreadGrpArgMandatory(false),
       m_ThreadArgMandatory(false), m_FrameArgMandatory(false) {}
@@ -69,6 +70,84 @@ const CMIUtilString &CMICmdBase::GetErrorDescription() const {
 //--
 const CMIUtilString &CMICmdBase::GetMiCmd() const { return m_strMiCmd; }
 
+//++
+// Details: Give m_setCmdArgs the arguments common to all commands and those
+//          *this command declares. Done once for the life of *this command
+//          object, later calls do nothing.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdBase::AddArgs() {
+  if (m_bArgsAdded)
+    return;
+
+  AddCommonArgs();
+  DeclareArgs();
+  m_bArgsAdded = true;
+}
+
+//++
+// Details: Retrieve the arguments *this command takes. Empty until AddArgs()
+//          is called.
+// Type:    Method.
+// Args:    None.
+// Return:  CMICmdArgSet & - The command's arguments.
+// Throws:  None.
+//--
+const CMICmdArgSet &CMICmdBase::GetArgSet() const { return m_setCmdArgs; }
+
+//++
+// Details: Take the arguments a command of the same type declared, kept by
+//          the command factory, rather than declaring them again. Does
+//          nothing if *this command already has its arguments or the
+//          container is empty.
+// Type:    Method.
+// Args:    vwrArgSet   - (RW) Arguments of *this command's type, left empty.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdBase::ArgSetAdopt(CMICmdArgSet &vwrArgSet) {
+  if (m_bArgsAdded || (vwrArgSet.GetCount() == 0))
+    return;
+
+  m_setCmdArgs.Take(vwrArgSet);
+  m_bArgsAdded = true;
+}
+
+//++
+// Details: Give up the arguments *this command declared so the command
+//          factory can give them to the next command of the same type. Does
+//          nothing if *this command has no arguments yet or the container is
+//          not empty.
+// Type:    Method.
+// Args:    vwrArgSet   - (W) Empty container to take the arguments.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdBase::ArgSetRelease(CMICmdArgSet &vwrArgSet) {
+  if (!m_bArgsAdded || (vwrArgSet.GetCount() != 0))
+    return;
+
+  vwrArgSet.Take(m_setCmdArgs);
+  m_bArgsAdded = false;
+}
+
+//++
+// Details: Add to m_setCmdArgs the arguments *this command takes, in the order
+//          they are parsed. Called once for the life of *this command object,
+//          and not at all if it adopted the arguments of an earlier command.
+//          Override to declare the command's arguments.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdBase::DeclareArgs() {
+  // Do nothing - override to implement
+}
+
 //++
 // Details: Help parse the arguments that are common to all commands.
 // Args:    None.
@@ -270,18 +349,16 @@ MIuint CMICmdBase::GetGUID() {
 //++
 // Details: The invoker requires this function. The parses the command line
 // options
-//          arguments to extract values for each of those arguments.
+//          arguments to extract values for each of those arguments declared
+//          in DeclareArgs(). Override to take the options without checking
+//          them.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdBase::ParseArgs() {
-  // Do nothing - override to implement
-
-  return MIstatus::success;
-}
+bool CMICmdBase::ParseArgs() { return ParseValidateCmdOptions(); }
 
 //++
 // Details: Having previously given CMICmdArgSet m_setCmdArgs all the argument
@@ -326,3 +403,31 @@ bool CMICmdBase::ParseValidateCmdOptions() {
 // Throws:  None.
 //--
 bool CMICmdBase::GetExitAppOnCommandFailure() const { return false; }
+
+//++
+// Details: Return *this command to the state it was created in so the command
+//          factory can hand it out again instead of creating a new command.
+//          The arguments are kept, each forgets its value. Commands that opt
+//          in to being reused set m_bReusable in their constructor and
+//          override this function to reset their own members before calling
+//          this function.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded, *this can be reused.
+//          MIstatus::failure - *this command cannot be reused, delete it.
+// Throws:  None.
+//--
+bool CMICmdBase::Reset() {
+  if (!m_bReusable)
+    return MIstatus::failure;
+
+  m_strCurrentErrDescription.clear();
+  ClrErrorDescription();
+  m_cmdData = SMICmdData();
+  m_miResultRecord = CMICmnMIResultRecord();
+  m_miResultRecordExtra.clear();
+  m_bHasResultRecordExtra = false;
+  m_setCmdArgs.Reset();
+
+  return MIstatus::success;
+}
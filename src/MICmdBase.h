@@ -47,6 +47,12 @@ class CMICmnLLDBDebugSessionInfo;
 //          to factor handling and parsing of different types of arguments
 //          presented to a command. A command will produce an error should it
 //          be presented with arguments or options it does not understand.
+//          A command declares the arguments it takes in DeclareArgs(). The
+//          argument objects hold the values parsed and are reset, not
+//          recreated, when the command object is reused. The factory keeps
+//          the arguments of a command that is deleted and gives them to the
+//          next new command of that type, so DeclareArgs() is called about
+//          once for each command type.
 //--
 class CMICmdBase : public CMICmnBase,
                    public CMICmdInvoker::ICmd,
@@ -70,11 +76,16 @@ public:
   CMICmdFactory::CmdCreatorFnPtr GetCmdCreatorFn() const override;
 
   virtual MIuint GetGUID();
-  void AddCommonArgs();
+  void AddArgs();
+  const CMICmdArgSet &GetArgSet() const;
+  void ArgSetAdopt(CMICmdArgSet &vwrArgSet);
+  void ArgSetRelease(CMICmdArgSet &vwrArgSet);
 
   // Overrideable:
   ~CMICmdBase() override;
   virtual bool GetExitAppOnCommandFailure() const;
+  virtual bool Reset();
+  virtual void DeclareArgs();
 
   // Methods:
 protected:
@@ -90,6 +101,7 @@ protected:
                                 const std::function<void()> &errorHandler);
   template <class T> T *GetOption(const CMIUtilString &vStrOptionName);
   bool ParseValidateCmdOptions();
+  void AddCommonArgs();
 
   // Attributes:
   CMICmdFactory::CmdCreatorFnPtr m_pSelfCreatorFn;
@@ -98,6 +110,9 @@ protected:
   SMICmdData m_cmdData; // Holds information/status of *this command. Used by
                         // other MI code to report or determine state of a
                         // command.
+  bool m_bReusable; // True = Reset() returns *this command to the state it
+                    // was created in so the factory can reuse it, false =
+                    // *this command is deleted when finished
   bool m_bWaitForEventFromSBDebugger; // True = yes event type command wait,
                                       // false = command calls Acknowledge()
                                       // straight after Execute()
@@ -122,6 +137,8 @@ protected:
                                 // output to its 1 line response, false = no
                                 // extra MI output
                                 // formed.
+  bool m_bArgsAdded; // True = m_setCmdArgs holds the arguments *this command
+                     // takes, false = DeclareArgs() not called yet
   CMICmdArgSet m_setCmdArgs;    // The list of arguments *this command needs to
                              // parse from the options string to carry out work.
   const CMIUtilString m_constStrArgThreadGroup;
@@ -37,6 +37,16 @@ CMICmdCmdEnablePrettyPrinting::CMICmdCmdEnablePrettyPrinting() {
 //--
 CMICmdCmdEnablePrettyPrinting::~CMICmdCmdEnablePrettyPrinting() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdEnablePrettyPrinting::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -111,6 +121,16 @@ CMICmdCmdSource::CMICmdCmdSource() {
 //--
 CMICmdCmdSource::~CMICmdCmdSource() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdSource::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -61,6 +61,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdEnablePrettyPrinting() override;
 };
@@ -85,6 +86,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdSource() override;
 };
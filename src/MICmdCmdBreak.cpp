@@ -69,16 +69,14 @@ CMICmdCmdBreakInsert::CMICmdCmdBreakInsert()
 CMICmdCmdBreakInsert::~CMICmdCmdBreakInsert() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakInsert::ParseArgs() {
+void CMICmdCmdBreakInsert::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValOptionShort(m_constStrArgNamedTempBreakpoint,
                                                false, true));
   // Not implemented m_setCmdArgs.Add(new CMICmdArgValOptionShort(
@@ -100,7 +98,6 @@ bool CMICmdCmdBreakInsert::ParseArgs() {
       CMICmdArgValListBase::eArgValType_Number, 1));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgNamedLocation, false,
                                           true, false, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -412,20 +409,17 @@ CMICmdCmdBreakDelete::CMICmdCmdBreakDelete()
 CMICmdCmdBreakDelete::~CMICmdCmdBreakDelete() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakDelete::ParseArgs() {
+void CMICmdCmdBreakDelete::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValListOfN(m_constStrArgNamedBreakpoint, true, true,
                               CMICmdArgValListBase::eArgValType_Number));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -543,20 +537,17 @@ CMICmdCmdBreakDisable::CMICmdCmdBreakDisable()
 CMICmdCmdBreakDisable::~CMICmdCmdBreakDisable() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakDisable::ParseArgs() {
+void CMICmdCmdBreakDisable::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValListOfN(m_constStrArgNamedBreakpoint, true, true,
                               CMICmdArgValListBase::eArgValType_Number));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -687,20 +678,17 @@ CMICmdCmdBreakEnable::CMICmdCmdBreakEnable()
 CMICmdCmdBreakEnable::~CMICmdCmdBreakEnable() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakEnable::ParseArgs() {
+void CMICmdCmdBreakEnable::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValListOfN(m_constStrArgNamedBreakpoint, true, true,
                               CMICmdArgValListBase::eArgValType_Number));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -830,20 +818,17 @@ CMICmdCmdBreakAfter::CMICmdCmdBreakAfter()
 CMICmdCmdBreakAfter::~CMICmdCmdBreakAfter() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakAfter::ParseArgs() {
+void CMICmdCmdBreakAfter::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValNumber(m_constStrArgNamedNumber, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNamedCount, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -973,16 +958,14 @@ CMICmdCmdBreakCondition::CMICmdCmdBreakCondition()
 CMICmdCmdBreakCondition::~CMICmdCmdBreakCondition() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakCondition::ParseArgs() {
+void CMICmdCmdBreakCondition::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValNumber(m_constStrArgNamedNumber, true, true));
   m_setCmdArgs.Add(
@@ -990,7 +973,6 @@ bool CMICmdCmdBreakCondition::ParseArgs() {
   m_setCmdArgs.Add(new CMICmdArgValListOfN(
       m_constStrArgNamedExprNoQuotes, false, false,
       CMICmdArgValListBase::eArgValType_StringQuotedNumber));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1157,21 +1139,19 @@ CMICmdCmdBreakWatch::CMICmdCmdBreakWatch()
 }
 
 //++
-// Details: The invoker requires this function. The parses the command line
-//          options arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdBreakWatch::ParseArgs() {
+void CMICmdCmdBreakWatch::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValOptionShort(
       m_constStrArgNamedAccessWatchpoint, false, true));
   m_setCmdArgs.Add(new CMICmdArgValOptionShort(m_constStrArgNamedReadWatchpoint,
                                                false, true));
   m_setCmdArgs.Add(new CMICmdArgValText(m_constStrArgNamedExpr, true, true));
-  return ParseValidateCmdOptions();
 }
 
 static bool FindLocalVariableAddress(lldb::SBTarget &rSbTarget,
@@ -56,7 +56,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakInsert() override;
 
@@ -121,7 +122,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakDelete() override;
 
@@ -150,7 +152,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakDisable() override;
 
@@ -181,7 +184,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakEnable() override;
 
@@ -212,7 +216,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakAfter() override;
 
@@ -264,7 +269,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakCondition() override;
 
@@ -320,7 +326,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdBreakWatch() override = default;
 
@@ -24,8 +24,11 @@
 #include "lldb/API/SBThread.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
+#include <algorithm>
+#include <cstdint>
 #include <inttypes.h>
 #include <string>
+#include <vector>
 
 // In-house headers:
 #include "MICmdArgValConsume.h"
@@ -50,6 +53,18 @@ namespace {
 CMIUtilString IntToHexAddrStr(uint32_t number) {
   return CMIUtilString("0x" + llvm::Twine::utohexstr(number).str());
 }
+
+// Retrieve the value of the --encoding option, hex when it is not given
+bool GetEncodingOption(const CMICmdArgValOptionLong &vrArgEncoding,
+                       CMIUtilEncode::Encoding_e &vwEncoding,
+                       CMIUtilString &vwName) {
+  vwEncoding = CMIUtilEncode::eEncoding_Hex;
+  if (!vrArgEncoding.GetFound())
+    return MIstatus::success;
+  return vrArgEncoding.GetExpectedOption<CMICmdArgValString, CMIUtilString>(
+             vwName) &&
+         CMIUtilEncode::GetEncoding(vwName, vwEncoding);
+}
 } // namespace
 
 //++
@@ -80,18 +95,15 @@ CMICmdCmdDataEvaluateExpression::CMICmdCmdDataEvaluateExpression()
 CMICmdCmdDataEvaluateExpression::~CMICmdCmdDataEvaluateExpression() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataEvaluateExpression::ParseArgs() {
+void CMICmdCmdDataEvaluateExpression::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValText(m_constStrArgExpr, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -119,6 +131,8 @@ bool CMICmdCmdDataEvaluateExpression::Execute() {
 
   lldb::SBFrame frame = thread.GetSelectedFrame();
   lldb::SBValue value = frame.EvaluateExpression(rExpression.c_str());
+  // The expression may have written to the inferior
+  rSessionInfo.SnapshotInvalidate();
   m_Error = value.GetError();
   if (!value.IsValid() || m_Error.Fail())
     value = frame.FindVariable(rExpression.c_str());
@@ -141,7 +155,7 @@ bool CMICmdCmdDataEvaluateExpression::Execute() {
     m_strValue = rExpression.Trim('\"');
     return MIstatus::success;
   }
-  m_strValue = utilValue.GetValue(true).Escape().AddSlashes();
+  m_strValue = utilValue.GetValue(true).EscapeAndAddSlashes();
   return MIstatus::success;
 }
 
@@ -159,7 +173,7 @@ bool CMICmdCmdDataEvaluateExpression::Acknowledge() {
   if (m_bExpressionValid) {
     if (m_bEvaluatedExpression) {
       if (m_bFoundInvalidChar) {
-        const CMICmnMIValueConst miValueConst(CMIUtilString::Format(
+        const CMICmnMIValueConst miValueConst(CMIUtilString::FormatTyped(
             "Invalid character '%c' in expression", m_cExpressionInvalidChar));
         const CMICmnMIValueResult miValueResult("msg", miValueConst);
         const CMICmnMIResultRecord miRecordResult(
@@ -261,16 +275,14 @@ CMICmdCmdDataDisassemble::CMICmdCmdDataDisassemble()
 CMICmdCmdDataDisassemble::~CMICmdCmdDataDisassemble() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataDisassemble::ParseArgs() {
+void CMICmdCmdDataDisassemble::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValOptionShort(
       m_constStrArgAddrStart, true, true,
       CMICmdArgValListBase::eArgValType_StringQuotedNumber, 1));
@@ -278,7 +290,6 @@ bool CMICmdCmdDataDisassemble::ParseArgs() {
       m_constStrArgAddrEnd, true, true,
       CMICmdArgValListBase::eArgValType_StringQuotedNumber, 1));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgMode, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -356,7 +367,7 @@ bool CMICmdCmdDataDisassemble::Execute() {
     const char *pStrComment = instrt.GetComment(sbTarget);
     CMIUtilString strComment;
     if (pStrComment != nullptr && *pStrComment != '\0')
-      strComment = CMIUtilString::Format("; %s", pStrComment);
+      strComment = CMIUtilString::FormatTyped("; %s", pStrComment);
     lldb::SBAddress address = instrt.GetAddress();
     lldb::addr_t addr = address.GetLoadAddress(sbTarget);
 
@@ -404,23 +415,23 @@ bool CMICmdCmdDataDisassemble::Execute() {
     // MI "{address=\"0x%016" PRIx64
     // "\",func-name=\"%s\",offset=\"%lld\",inst=\"%s %s\"}"
     const CMICmnMIValueConst miValueConst(
-        CMIUtilString::Format("0x%016" PRIx64, addr));
+        CMIUtilString::FormatTyped("0x%016" PRIx64, addr));
     const CMICmnMIValueResult miValueResult("address", miValueConst);
     CMICmnMIValueTuple miValueTuple(miValueResult);
     const CMICmnMIValueConst miValueConst2(pFnName);
     const CMICmnMIValueResult miValueResult2("func-name", miValueConst2);
     miValueTuple.Add(miValueResult2);
     const CMICmnMIValueConst miValueConst3(
-        CMIUtilString::Format("%lld", addrOffset));
+        CMIUtilString::FormatTyped("%lld", addrOffset));
     const CMICmnMIValueResult miValueResult3("offset", miValueConst3);
     miValueTuple.Add(miValueResult3);
     const CMICmnMIValueConst miValueConst4(
-        CMIUtilString::Format("%d", instrtSize));
+        CMIUtilString::FormatTyped("%d", instrtSize));
     const CMICmnMIValueResult miValueResult4("size", miValueConst4);
     miValueTuple.Add(miValueResult4);
     const CMICmnMIValueConst miValueConst5(
-        CMIUtilString::Format("%s %s%s", pStrMnemonic, pStrOperands,
-                              strComment.Escape(true).c_str()));
+        CMIUtilString::FormatTyped("%s %s%s", pStrMnemonic, pStrOperands,
+                                   strComment.Escape(true)));
     const CMICmnMIValueResult miValueResult5("inst", miValueConst5);
     miValueTuple.Add(miValueResult5);
 
@@ -435,7 +446,8 @@ bool CMICmdCmdDataDisassemble::Execute() {
 
       // MI "src_and_asm_line={line=\"%u\",file=\"%s\",line_asm_insn=[ ],
       // fullname=\"%s\"}"
-      const CMICmnMIValueConst miValueConst(CMIUtilString::Format("%u", nLine));
+      const CMICmnMIValueConst miValueConst(
+          CMIUtilString::FormatTyped("%u", nLine));
       const CMICmnMIValueResult miValueResult("line", miValueConst);
       CMICmnMIValueTuple miValueTuple2(miValueResult);
       const CMICmnMIValueConst miValueConst2(pFileName);
@@ -499,9 +511,10 @@ CMICmdBase *CMICmdCmdDataDisassemble::CreateSelf() {
 // Throws:  None.
 //--
 CMICmdCmdDataReadMemoryBytes::CMICmdCmdDataReadMemoryBytes()
-    : m_constStrArgByteOffset("o"), m_constStrArgAddrExpr("address"),
-      m_constStrArgNumBytes("count"), m_pBufferMemory(nullptr), m_nAddrStart(0),
-      m_nAddrNumBytesToRead(0) {
+    : m_constStrArgByteOffset("o"), m_constStrArgEncoding("encoding"),
+      m_constStrArgAddrExpr("address"), m_constStrArgNumBytes("count"),
+      m_pBufferMemory(nullptr), m_nAddrStart(0), m_nAddrNumBytesToRead(0),
+      m_eEncoding(CMIUtilEncode::eEncoding_Hex) {
   // Command factory matches this name with that received from the stdin stream
   m_strMiCmd = "data-read-memory-bytes";
 
@@ -524,23 +537,23 @@ CMICmdCmdDataReadMemoryBytes::~CMICmdCmdDataReadMemoryBytes() {
 }
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataReadMemoryBytes::ParseArgs() {
+void CMICmdCmdDataReadMemoryBytes::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValOptionShort(m_constStrArgByteOffset, false, true,
                                   CMICmdArgValListBase::eArgValType_Number, 1));
+  m_setCmdArgs.Add(
+      new CMICmdArgValOptionLong(m_constStrArgEncoding, false, true,
+                                 CMICmdArgValListBase::eArgValType_String, 1));
   m_setCmdArgs.Add(
       new CMICmdArgValString(m_constStrArgAddrExpr, true, true, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNumBytes, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -558,9 +571,18 @@ bool CMICmdCmdDataReadMemoryBytes::Execute() {
   CMICMDBASE_GETOPTION(pArgThread, OptionLong, m_constStrArgThread);
   CMICMDBASE_GETOPTION(pArgFrame, OptionLong, m_constStrArgFrame);
   CMICMDBASE_GETOPTION(pArgAddrOffset, OptionShort, m_constStrArgByteOffset);
+  CMICMDBASE_GETOPTION(pArgEncoding, OptionLong, m_constStrArgEncoding);
   CMICMDBASE_GETOPTION(pArgAddrExpr, String, m_constStrArgAddrExpr);
   CMICMDBASE_GETOPTION(pArgNumBytes, Number, m_constStrArgNumBytes);
 
+  CMIUtilString strEncoding;
+  if (!GetEncodingOption(*pArgEncoding, m_eEncoding, strEncoding)) {
+    SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_DATA_ENCODING_INVALID),
+                                   m_cmdData.strMiCmd.c_str(),
+                                   strEncoding.c_str()));
+    return MIstatus::failure;
+  }
+
   // get the --thread option value
   MIuint64 nThreadId = UINT64_MAX;
   if (pArgThread->GetFound() &&
@@ -686,34 +708,39 @@ bool CMICmdCmdDataReadMemoryBytes::Acknowledge() {
   // MI: memory=[{begin=\"0x%016" PRIx64 "\",offset=\"0x%016" PRIx64"
   // \",end=\"0x%016" PRIx64 "\",contents=\" \" }]"
   const CMICmnMIValueConst miValueConst(
-      CMIUtilString::Format("0x%016" PRIx64, m_nAddrStart));
+      CMIUtilString::FormatTyped("0x%016" PRIx64, m_nAddrStart));
   const CMICmnMIValueResult miValueResult("begin", miValueConst);
   CMICmnMIValueTuple miValueTuple(miValueResult);
   const MIuint64 nAddrOffset = 0;
   const CMICmnMIValueConst miValueConst2(
-      CMIUtilString::Format("0x%016" PRIx64, nAddrOffset));
+      CMIUtilString::FormatTyped("0x%016" PRIx64, nAddrOffset));
   const CMICmnMIValueResult miValueResult2("offset", miValueConst2);
   miValueTuple.Add(miValueResult2);
-  const CMICmnMIValueConst miValueConst3(CMIUtilString::Format(
+  const CMICmnMIValueConst miValueConst3(CMIUtilString::FormatTyped(
       "0x%016" PRIx64, m_nAddrStart + m_nAddrNumBytesToRead));
   const CMICmnMIValueResult miValueResult3("end", miValueConst3);
   miValueTuple.Add(miValueResult3);
 
   // MI: contents=\" \"
   CMIUtilString strContent;
-  strContent.reserve((m_nAddrNumBytesToRead << 1) + 1);
-  for (MIuint64 i = 0; i < m_nAddrNumBytesToRead; i++) {
-    strContent += CMIUtilString::Format("%02hhx", m_pBufferMemory[i]);
-  }
+  CMIUtilEncode::Append(strContent, m_eEncoding, m_pBufferMemory,
+                        static_cast<size_t>(m_nAddrNumBytesToRead));
   const CMICmnMIValueConst miValueConst4(strContent);
   const CMICmnMIValueResult miValueResult4("contents", miValueConst4);
   miValueTuple.Add(miValueResult4);
+  // MI: encoding=\" \", only when other than the default hex
+  if (m_eEncoding != CMIUtilEncode::eEncoding_Hex) {
+    const CMICmnMIValueConst miValueConst5(
+        CMIUtilEncode::GetEncodingName(m_eEncoding));
+    const CMICmnMIValueResult miValueResult5("encoding", miValueConst5);
+    miValueTuple.Add(miValueResult5);
+  }
   const CMICmnMIValueList miValueList(miValueTuple);
-  const CMICmnMIValueResult miValueResult5("memory", miValueList);
+  const CMICmnMIValueResult miValueResult6("memory", miValueList);
 
   const CMICmnMIResultRecord miRecordResult(
       m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
-      miValueResult5);
+      miValueResult6);
   m_miResultRecord = miRecordResult;
 
   return MIstatus::success;
@@ -756,6 +783,16 @@ CMICmdCmdDataReadMemory::CMICmdCmdDataReadMemory() {
 //--
 CMICmdCmdDataReadMemory::~CMICmdCmdDataReadMemory() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdDataReadMemory::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -835,20 +872,17 @@ CMICmdCmdDataListRegisterNames::CMICmdCmdDataListRegisterNames()
 CMICmdCmdDataListRegisterNames::~CMICmdCmdDataListRegisterNames() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataListRegisterNames::ParseArgs() {
+void CMICmdCmdDataListRegisterNames::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValListOfN(m_constStrArgRegNo, false, false,
                               CMICmdArgValListBase::eArgValType_Number));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1009,16 +1043,14 @@ CMICmdCmdDataListRegisterValues::CMICmdCmdDataListRegisterValues()
 CMICmdCmdDataListRegisterValues::~CMICmdCmdDataListRegisterValues() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataListRegisterValues::ParseArgs() {
+void CMICmdCmdDataListRegisterValues::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValOptionLong(m_constStrArgThread, false, false,
                                  CMICmdArgValListBase::eArgValType_Number, 1));
@@ -1027,7 +1059,6 @@ bool CMICmdCmdDataListRegisterValues::ParseArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValListOfN(m_constStrArgRegNo, false, true,
                               CMICmdArgValListBase::eArgValType_Number));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1188,7 +1219,8 @@ lldb::SBValue CMICmdCmdDataListRegisterValues::GetRegister(
 void CMICmdCmdDataListRegisterValues::AddToOutput(
     const MIuint vnIndex, const lldb::SBValue &vrValue,
     CMICmnLLDBDebugSessionInfoVarObj::varFormat_e veVarFormat) {
-  const CMICmnMIValueConst miValueConst(CMIUtilString::Format("%u", vnIndex));
+  const CMICmnMIValueConst miValueConst(
+      CMIUtilString::FormatTyped("%u", vnIndex));
   const CMICmnMIValueResult miValueResult("number", miValueConst);
   CMICmnMIValueTuple miValueTuple(miValueResult);
   const CMIUtilString strRegValue(
@@ -1224,6 +1256,16 @@ CMICmdCmdDataListRegisterChanged::CMICmdCmdDataListRegisterChanged() {
 //--
 CMICmdCmdDataListRegisterChanged::~CMICmdCmdDataListRegisterChanged() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdDataListRegisterChanged::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -1283,8 +1325,8 @@ CMICmdBase *CMICmdCmdDataListRegisterChanged::CreateSelf() {
 // Throws:  None.
 //--
 CMICmdCmdDataWriteMemoryBytes::CMICmdCmdDataWriteMemoryBytes()
-    : m_constStrArgAddrExpr("address"), m_constStrArgContents("contents"),
-      m_constStrArgCount("count") {
+    : m_constStrArgEncoding("encoding"), m_constStrArgAddrExpr("address"),
+      m_constStrArgContents("contents"), m_constStrArgCount("count") {
   // Command factory matches this name with that received from the stdin stream
   m_strMiCmd = "data-write-memory-bytes";
 
@@ -1302,22 +1344,22 @@ CMICmdCmdDataWriteMemoryBytes::CMICmdCmdDataWriteMemoryBytes()
 CMICmdCmdDataWriteMemoryBytes::~CMICmdCmdDataWriteMemoryBytes() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataWriteMemoryBytes::ParseArgs() {
+void CMICmdCmdDataWriteMemoryBytes::DeclareArgs() {
+  m_setCmdArgs.Add(
+      new CMICmdArgValOptionLong(m_constStrArgEncoding, false, true,
+                                 CMICmdArgValListBase::eArgValType_String, 1));
   m_setCmdArgs.Add(
       new CMICmdArgValString(m_constStrArgAddrExpr, true, true, false, true));
   m_setCmdArgs.Add(
       new CMICmdArgValString(m_constStrArgContents, true, true, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgCount, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1334,10 +1376,20 @@ bool CMICmdCmdDataWriteMemoryBytes::ParseArgs() {
 bool CMICmdCmdDataWriteMemoryBytes::Execute() {
   CMICMDBASE_GETOPTION(pArgThread, OptionLong, m_constStrArgThread);
   CMICMDBASE_GETOPTION(pArgFrame, OptionLong, m_constStrArgFrame);
+  CMICMDBASE_GETOPTION(pArgEncoding, OptionLong, m_constStrArgEncoding);
   CMICMDBASE_GETOPTION(pArgAddrExpr, String, m_constStrArgAddrExpr);
   CMICMDBASE_GETOPTION(pArgContents, String, m_constStrArgContents);
   CMICMDBASE_GETOPTION(pArgCount, Number, m_constStrArgCount);
 
+  CMIUtilEncode::Encoding_e eEncoding;
+  CMIUtilString strEncoding;
+  if (!GetEncodingOption(*pArgEncoding, eEncoding, strEncoding)) {
+    SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_DATA_ENCODING_INVALID),
+                                   m_cmdData.strMiCmd.c_str(),
+                                   strEncoding.c_str()));
+    return MIstatus::failure;
+  }
+
   // get the --thread option value
   MIuint64 nThreadId = UINT64_MAX;
   if (pArgThread->GetFound() &&
@@ -1403,25 +1455,40 @@ bool CMICmdCmdDataWriteMemoryBytes::Execute() {
     return MIstatus::failure;
   }
 
-  const MIuint64 nContentSize = pArgContents->GetValue().length() / 2;
+  // Run length contents may decode to no more than the count, or a fixed
+  // limit without one, so a short command cannot take all memory
+  const CMIUtilString &rContents = pArgContents->GetValue();
+  const size_t nDecodeMax =
+      pArgCount->GetFound()
+          ? static_cast<size_t>(std::min<MIuint64>(pArgCount->GetValue(),
+                                                   SIZE_MAX))
+          : CMIUtilEncode::ms_nDecodeSizeMax;
+  std::vector<unsigned char> vecBufferMemory;
+  if (!CMIUtilEncode::Decode(eEncoding, rContents.c_str(), rContents.length(),
+                             nDecodeMax, vecBufferMemory)) {
+    SetError(CMIUtilString::Format(
+        MIRSRC(IDS_CMD_ERR_DATA_CONTENTS_INVALID), m_cmdData.strMiCmd.c_str(),
+        CMIUtilEncode::GetEncodingName(eEncoding)));
+    return MIstatus::failure;
+  }
+  const MIuint64 nContentSize = vecBufferMemory.size();
   const MIuint64 nBufferSize =
       pArgCount->GetFound() ? pArgCount->GetValue() : nContentSize;
-  unsigned char *pBufferMemory = new unsigned char[nBufferSize];
-  if (pBufferMemory == nullptr) {
-    SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_MEMORY_ALLOC_FAILURE),
-                                   m_cmdData.strMiCmd.c_str(), nBufferSize));
+  if ((nContentSize == 0) && (nBufferSize != 0)) {
+    SetError(CMIUtilString::Format(
+        MIRSRC(IDS_CMD_ERR_DATA_CONTENTS_INVALID), m_cmdData.strMiCmd.c_str(),
+        CMIUtilEncode::GetEncodingName(eEncoding)));
     return MIstatus::failure;
   }
+  // A count larger than the contents repeats the contents
+  vecBufferMemory.resize(static_cast<size_t>(nBufferSize));
+  for (MIuint64 i = nContentSize; i < nBufferSize; i++)
+    vecBufferMemory[i] = vecBufferMemory[i % nContentSize];
 
-  for (MIuint64 i = 0; i < nBufferSize; i++) {
-    const CMIUtilString byteStr =
-        pArgContents->GetValue().substr((i % nContentSize) * 2, 2);
-    pBufferMemory[i] = ::strtoul(byteStr.c_str(), nullptr, 16);
-  }
-
-  MIuint64 nWritten = sbProcess.WriteMemory(
-      static_cast<lldb::addr_t>(nAddrStart), pBufferMemory, nBufferSize, error);
-  delete[] pBufferMemory;
+  MIuint64 nWritten =
+      sbProcess.WriteMemory(static_cast<lldb::addr_t>(nAddrStart),
+                            vecBufferMemory.data(), nBufferSize, error);
+  rSessionInfo.SnapshotInvalidate();
 
   if (nWritten != nBufferSize) {
     SetError(CMIUtilString::Format(
@@ -1508,16 +1575,14 @@ CMICmdCmdDataWriteMemory::~CMICmdCmdDataWriteMemory() {
 }
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataWriteMemory::ParseArgs() {
+void CMICmdCmdDataWriteMemory::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValOptionShort(m_constStrArgOffset, false, true,
                                   CMICmdArgValListBase::eArgValType_Number, 1));
@@ -1525,7 +1590,6 @@ bool CMICmdCmdDataWriteMemory::ParseArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgD, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNumber, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgContents, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1572,6 +1636,7 @@ bool CMICmdCmdDataWriteMemory::Execute() {
   lldb::addr_t addr = static_cast<lldb::addr_t>(m_nAddr + nAddrOffset);
   const size_t nBytesWritten = sbProcess.WriteMemory(
       addr, (const void *)m_pBufferMemory, (size_t)m_nCount, error);
+  rSessionInfo.SnapshotInvalidate();
   if (nBytesWritten != static_cast<size_t>(m_nCount)) {
     SetError(
         CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_LLDB_ERR_NOT_WRITE_WHOLEBLK),
@@ -1648,18 +1713,15 @@ CMICmdCmdDataInfoLine::CMICmdCmdDataInfoLine()
 CMICmdCmdDataInfoLine::~CMICmdCmdDataInfoLine() = default;
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdDataInfoLine::ParseArgs() {
+void CMICmdCmdDataInfoLine::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgLocation, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
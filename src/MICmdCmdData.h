@@ -41,6 +41,7 @@
 #include "MICmnMIResultRecord.h"
 #include "MICmnMIValueList.h"
 #include "MICmnMIValueTuple.h"
+#include "MIUtilEncode.h"
 
 //++
 //============================================================================
@@ -62,7 +63,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataEvaluateExpression() override;
 
@@ -106,7 +108,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataDisassemble() override;
 
@@ -140,18 +143,21 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataReadMemoryBytes() override;
 
   // Attributes:
 private:
   const CMIUtilString m_constStrArgByteOffset;
+  const CMIUtilString m_constStrArgEncoding;
   const CMIUtilString m_constStrArgAddrExpr;
   const CMIUtilString m_constStrArgNumBytes;
   unsigned char *m_pBufferMemory;
   MIuint64 m_nAddrStart;
   MIuint64 m_nAddrNumBytesToRead;
+  CMIUtilEncode::Encoding_e m_eEncoding; // Encoding of the contents
 };
 
 //++
@@ -174,6 +180,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataReadMemory() override;
 };
@@ -198,7 +205,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataListRegisterNames() override;
 
@@ -232,7 +240,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataListRegisterValues() override;
 
@@ -270,6 +279,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataListRegisterChanged() override;
 };
@@ -294,12 +304,14 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataWriteMemoryBytes() override;
 
   // Attributes:
 private:
+  const CMIUtilString m_constStrArgEncoding;
   const CMIUtilString m_constStrArgAddrExpr;
   const CMIUtilString m_constStrArgContents;
   const CMIUtilString m_constStrArgCount;
@@ -327,7 +339,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataWriteMemory() override;
 
@@ -370,7 +383,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdDataInfoLine() override;
 
@@ -42,19 +42,15 @@ CMICmdCmdEnvironmentCd::CMICmdCmdEnvironmentCd()
 CMICmdCmdEnvironmentCd::~CMICmdCmdEnvironmentCd() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdEnvironmentCd::ParseArgs() {
+void CMICmdCmdEnvironmentCd::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValFile(m_constStrArgNamePathDir, true, true));
-  CMICmdArgContext argCntxt(m_cmdData.strMiCmdOption);
-  return ParseValidateCmdOptions();
 }
 
 //++
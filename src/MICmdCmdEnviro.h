@@ -47,7 +47,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdEnvironmentCd() override;
 
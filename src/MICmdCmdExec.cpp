@@ -65,20 +65,17 @@ CMICmdCmdExecRun::CMICmdCmdExecRun() : m_constStrArgStart("start") {
 CMICmdCmdExecRun::~CMICmdCmdExecRun() {}
 
 //++
-// Details: The invoker requires this function. It parses the command line
-// options'
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdExecRun::ParseArgs() {
+void CMICmdCmdExecRun::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValOptionLong(
       m_constStrArgStart, false, true,
       CMICmdArgValListBase::eArgValType_OptionLong, 0));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -216,6 +213,16 @@ CMICmdCmdExecContinue::CMICmdCmdExecContinue() {
 //--
 CMICmdCmdExecContinue::~CMICmdCmdExecContinue() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdExecContinue::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -299,18 +306,15 @@ CMICmdCmdExecNext::CMICmdCmdExecNext() : m_constStrArgNumber("number") {
 CMICmdCmdExecNext::~CMICmdCmdExecNext() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdExecNext::ParseArgs() {
+void CMICmdCmdExecNext::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNumber, false, false));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -410,18 +414,15 @@ CMICmdCmdExecStep::CMICmdCmdExecStep() : m_constStrArgNumber("number") {
 CMICmdCmdExecStep::~CMICmdCmdExecStep() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdExecStep::ParseArgs() {
+void CMICmdCmdExecStep::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNumber, false, false));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -522,18 +523,15 @@ CMICmdCmdExecNextInstruction::CMICmdCmdExecNextInstruction()
 CMICmdCmdExecNextInstruction::~CMICmdCmdExecNextInstruction() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdExecNextInstruction::ParseArgs() {
+void CMICmdCmdExecNextInstruction::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNumber, false, false));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -635,18 +633,15 @@ CMICmdCmdExecStepInstruction::CMICmdCmdExecStepInstruction()
 CMICmdCmdExecStepInstruction::~CMICmdCmdExecStepInstruction() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdExecStepInstruction::ParseArgs() {
+void CMICmdCmdExecStepInstruction::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgNumber, false, false));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -746,18 +741,6 @@ CMICmdCmdExecFinish::CMICmdCmdExecFinish() {
 //--
 CMICmdCmdExecFinish::~CMICmdCmdExecFinish() {}
 
-//++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
-// Type:    Overridden.
-// Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
-// Throws:  None.
-//--
-bool CMICmdCmdExecFinish::ParseArgs() { return ParseValidateCmdOptions(); }
-
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -855,6 +838,16 @@ CMICmdCmdExecInterrupt::CMICmdCmdExecInterrupt() {
 //--
 CMICmdCmdExecInterrupt::~CMICmdCmdExecInterrupt() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdExecInterrupt::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -939,20 +932,17 @@ CMICmdCmdExecArguments::CMICmdCmdExecArguments()
 CMICmdCmdExecArguments::~CMICmdCmdExecArguments() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Function succeeded.
-//          MIstatus::failure - Function failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdExecArguments::ParseArgs() {
+void CMICmdCmdExecArguments::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValListOfN(
       m_constStrArgArguments, false, true,
       CMICmdArgValListBase::eArgValType_StringAnything));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1048,6 +1038,16 @@ CMICmdCmdExecAbort::CMICmdCmdExecAbort() {
 //--
 CMICmdCmdExecAbort::~CMICmdCmdExecAbort() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdExecAbort::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -55,7 +55,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecRun() override;
 
@@ -85,6 +86,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecContinue() override;
 };
@@ -109,7 +111,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecNext() override;
 
@@ -139,7 +142,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecStep() override;
 
@@ -169,7 +173,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecNextInstruction() override;
 
@@ -199,7 +204,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecStepInstruction() override;
 
@@ -229,7 +235,6 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecFinish() override;
 };
@@ -258,6 +263,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecInterrupt() override;
 };
@@ -282,7 +288,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecArguments() override;
 
@@ -311,6 +318,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdExecAbort() override;
 };
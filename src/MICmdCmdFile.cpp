@@ -49,16 +49,14 @@ CMICmdCmdFileExecAndSymbols::CMICmdCmdFileExecAndSymbols()
 CMICmdCmdFileExecAndSymbols::~CMICmdCmdFileExecAndSymbols() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdFileExecAndSymbols::ParseArgs() {
+void CMICmdCmdFileExecAndSymbols::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValFile(m_constStrArgNameFile, true, true));
   m_setCmdArgs.Add(
       new CMICmdArgValOptionShort(m_constStrArgNamedPlatformName, false, true,
@@ -66,7 +64,6 @@ bool CMICmdCmdFileExecAndSymbols::ParseArgs() {
   m_setCmdArgs.Add(new CMICmdArgValOptionShort(
       m_constStrArgNamedRemotePath, false, true,
       CMICmdArgValListBase::eArgValType_StringQuotedNumberPath, 1));
-  return ParseValidateCmdOptions();
 }
 
 //++
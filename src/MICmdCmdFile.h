@@ -50,7 +50,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdFileExecAndSymbols() override;
   bool GetExitAppOnCommandFailure() const override;
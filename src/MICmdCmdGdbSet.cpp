@@ -29,7 +29,8 @@ const CMICmdCmdGdbSet::MapGdbOptionNameToFnGdbOptionPtr_t
         {"disassembly-flavor", &CMICmdCmdGdbSet::OptionFnDisassemblyFlavor},
         {"fallback", &CMICmdCmdGdbSet::OptionFnFallback},
         {"breakpoint", &CMICmdCmdGdbSet::OptionFnBreakpoint},
-        {"new-console", &CMICmdCmdGdbSet::OptionFnNewConsole}};
+        {"new-console", &CMICmdCmdGdbSet::OptionFnNewConsole},
+        {"varobj-limit", &CMICmdCmdGdbSet::OptionFnVarObjLimit}};
 
 //++
 // Details: CMICmdCmdGdbSet constructor.
@@ -59,20 +60,17 @@ CMICmdCmdGdbSet::CMICmdCmdGdbSet()
 CMICmdCmdGdbSet::~CMICmdCmdGdbSet() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdGdbSet::ParseArgs() {
+void CMICmdCmdGdbSet::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValListOfN(
       m_constStrArgNamedGdbOption, true, true,
       CMICmdArgValListBase::eArgValType_StringAnything));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -524,4 +522,29 @@ bool CMICmdCmdGdbSet::OptionFnNewConsole(
   }
   m_rLLDBDebugSessionInfo.SetCreateTty(bCreateNewConsole);
   return MIstatus::success;
-}
\ No newline at end of file
+}
+
+//++
+// Details: Carry out work to complete the GDB set option 'varobj-limit', the
+//          most var objects lldb-mi keeps before it deletes those used least
+//          recently.
+// Type:    Method.
+// Args:    vrWords - (R) List of additional parameters used by this option.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdGdbSet::OptionFnVarObjLimit(
+    const CMIUtilString::VecString_t &vrWords) {
+  MIint64 nLimit = 0;
+  if ((vrWords.size() != 1) || !vrWords[0].ExtractNumber(nLimit) ||
+      (nLimit < 0) || (nLimit > UINT32_MAX)) {
+    m_bGdbOptionFnHasError = true;
+    m_strGdbOptionFnError = MIRSRC(IDS_CMD_ERR_GDBSET_OPT_VAROBJ_LIMIT);
+    return MIstatus::failure;
+  }
+
+  CMICmnLLDBDebugSessionInfoVarObj::VarObjSetLimit(
+      static_cast<MIuint>(nLimit));
+  return MIstatus::success;
+}
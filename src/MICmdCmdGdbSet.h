@@ -59,7 +59,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdGdbSet() override;
 
@@ -82,6 +83,7 @@ private:
   bool OptionFnBreakpoint(const CMIUtilString::VecString_t &vrWords);
   bool OptionFnFallback(const CMIUtilString::VecString_t &vrWords);
   bool OptionFnNewConsole(const CMIUtilString::VecString_t &vrWords);
+  bool OptionFnVarObjLimit(const CMIUtilString::VecString_t &vrWords);
 
   // Attributes:
 private:
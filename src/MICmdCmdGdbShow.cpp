@@ -32,7 +32,8 @@ const CMICmdCmdGdbShow::MapGdbOptionNameToFnGdbOptionPtr_t
         {"language", &CMICmdCmdGdbShow::OptionFnLanguage},
         {"disassembly-flavor", &CMICmdCmdGdbShow::OptionFnDisassemblyFlavor},
         {"fallback", &CMICmdCmdGdbShow::OptionFnFallback},
-        {"breakpoint", &CMICmdCmdGdbShow::OptionFnBreakpoint}};
+        {"breakpoint", &CMICmdCmdGdbShow::OptionFnBreakpoint},
+        {"varobj-limit", &CMICmdCmdGdbShow::OptionFnVarObjLimit}};
 
 //++
 // Details: CMICmdCmdGdbShow constructor.
@@ -62,20 +63,17 @@ CMICmdCmdGdbShow::CMICmdCmdGdbShow()
 CMICmdCmdGdbShow::~CMICmdCmdGdbShow() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Function succeeded.
-//          MIstatus::failure - Function failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdGdbShow::ParseArgs() {
+void CMICmdCmdGdbShow::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValListOfN(
       m_constStrArgNamedGdbOption, true, true,
       CMICmdArgValListBase::eArgValType_StringAnything));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -396,3 +394,21 @@ bool CMICmdCmdGdbShow::OptionFnFallback(
 
   return MIstatus::success;
 }
+
+//++
+// Details: Carry out work to complete the GDB show option 'varobj-limit' to
+//          prepare and send back the requested information.
+// Type:    Method.
+// Args:    vrWords - (R) List of additional parameters used by this option.
+// Return:  MIstatus::success - Function succeeded.
+//          MIstatus::failure - Function failed.
+// Throws:  None.
+//--
+bool CMICmdCmdGdbShow::OptionFnVarObjLimit(
+    const CMIUtilString::VecString_t &vrWords) {
+  MIunused(vrWords);
+
+  m_strValue = CMIUtilString::FormatTyped(
+      "%u", CMICmnLLDBDebugSessionInfoVarObj::VarObjGetLimit());
+  return MIstatus::success;
+}
@@ -45,6 +45,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdGdbThread() override;
 };
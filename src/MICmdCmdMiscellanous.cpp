@@ -10,6 +10,7 @@
 //              CMICmdCmdListThreadGroups       implementation.
 //              CMICmdCmdInterpreterExec        implementation.
 //              CMICmdCmdInferiorTtySet         implementation.
+//              CMICmdCmdLldbMiStats            implementation.
 
 // Third Party Headers:
 #include "lldb/API/SBCommandInterpreter.h"
@@ -24,6 +25,7 @@
 #include "MICmdArgValString.h"
 #include "MICmdArgValThreadGrp.h"
 #include "MICmdCmdMiscellanous.h"
+#include "MICmdInvoker.h"
 #include "MICmnLLDBDebugSessionInfo.h"
 #include "MICmnLLDBDebugger.h"
 #include "MICmnMIOutOfBandRecord.h"
@@ -57,6 +59,16 @@ CMICmdCmdGdbExit::CMICmdCmdGdbExit() {
 //--
 CMICmdCmdGdbExit::~CMICmdCmdGdbExit() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdGdbExit::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -146,16 +158,14 @@ CMICmdCmdListThreadGroups::~CMICmdCmdListThreadGroups() {
 }
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdListThreadGroups::ParseArgs() {
+void CMICmdCmdListThreadGroups::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValOptionLong(m_constStrArgNamedAvailable, false, true));
   m_setCmdArgs.Add(
@@ -166,7 +176,6 @@ bool CMICmdCmdListThreadGroups::ParseArgs() {
                               CMICmdArgValListBase::eArgValType_Number));
   m_setCmdArgs.Add(
       new CMICmdArgValThreadGrp(m_constStrArgNamedThreadGroup, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -411,21 +420,18 @@ CMICmdCmdInterpreterExec::CMICmdCmdInterpreterExec()
 CMICmdCmdInterpreterExec::~CMICmdCmdInterpreterExec() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdInterpreterExec::ParseArgs() {
+void CMICmdCmdInterpreterExec::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValString(m_constStrArgNamedInterpreter, true, true));
   m_setCmdArgs.Add(
       new CMICmdArgValString(m_constStrArgNamedCommand, true, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -455,6 +461,8 @@ bool CMICmdCmdInterpreterExec::Execute() {
       rSessionInfo.GetDebugger().GetCommandInterpreter().HandleCommand(
           rStrCommand.c_str(), m_lldbResult, true);
   MIunused(rtn);
+  // The command may have changed anything about the process
+  rSessionInfo.SnapshotInvalidate();
 
   return MIstatus::success;
 }
@@ -537,6 +545,16 @@ CMICmdCmdInferiorTtySet::CMICmdCmdInferiorTtySet() {
 //--
 CMICmdCmdInferiorTtySet::~CMICmdCmdInferiorTtySet() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdInferiorTtySet::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -584,3 +602,307 @@ bool CMICmdCmdInferiorTtySet::Acknowledge() {
 CMICmdBase *CMICmdCmdInferiorTtySet::CreateSelf() {
   return new CMICmdCmdInferiorTtySet();
 }
+
+//++
+// Details: CMICmdCmdLldbMiStats constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdCmdLldbMiStats::CMICmdCmdLldbMiStats()
+    : m_constStrArgNamedReset("reset"), m_nPathCacheHits(0),
+      m_nPathCacheMisses(0), m_nVarObjs(0), m_nVarObjBytes(0),
+      m_nVarObjsEvicted(0), m_nStdoutRecords(0), m_nStdoutWrites(0) {
+  // Command factory matches this name with that received from the stdin stream
+  m_strMiCmd = "lldb-mi-stats";
+
+  // Required by the CMICmdFactory when registering *this command
+  m_pSelfCreatorFn = &CMICmdCmdLldbMiStats::CreateSelf;
+}
+
+//++
+// Details: CMICmdCmdLldbMiStats destructor.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdCmdLldbMiStats::~CMICmdCmdLldbMiStats() {}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdLldbMiStats::DeclareArgs() {
+  m_setCmdArgs.Add(
+      new CMICmdArgValOptionLong(m_constStrArgNamedReset, false, true));
+}
+
+//++
+// Details: The invoker requires this function. The command does work in this
+// function.
+//          Synopsis: -lldb-mi-stats [--reset]
+//          The statistics are formed before they are reset so --reset gives
+//          the statistics of the period it ends.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdLldbMiStats::Execute() {
+  CMICMDBASE_GETOPTION(pArgReset, OptionLong, m_constStrArgNamedReset);
+
+  CMICmdStats &rStats = CMICmdInvoker::Instance().GetStats();
+  rStats.GetMIText(m_strStats);
+  CMICmnLLDBDebugSessionInfo &rSessionInfo(
+      CMICmnLLDBDebugSessionInfo::Instance());
+  rSessionInfo.ResolvePathCacheGetCounts(m_nPathCacheHits, m_nPathCacheMisses);
+  CMICmnLLDBDebugSessionInfoVarObj::VarObjGetCounts(m_nVarObjs, m_nVarObjBytes,
+                                                    m_nVarObjsEvicted);
+  CMICmnStreamStdout::Instance().GetWriteStats(
+      m_nStdoutRecords, m_nStdoutWrites, m_histStdoutWriteNs);
+  if (pArgReset->GetFound()) {
+    rStats.Reset();
+    rSessionInfo.ResolvePathCacheResetCounts();
+  }
+
+  return MIstatus::success;
+}
+
+//++
+// Details: The invoker requires this function. The command prepares a MI Record
+// Result
+//          for the work carried out in the Execute().
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdLldbMiStats::Acknowledge() {
+  const CMICmnMIValueConst miValueConst(m_strStats, true);
+  const CMICmnMIValueResult miValueResult("stats", miValueConst);
+  CMICmnMIResultRecord miRecordResult(m_cmdData.strMiCmdToken,
+                                      CMICmnMIResultRecord::eResultClass_Done,
+                                      miValueResult);
+
+  // MI print "path-cache={hits=\"%llu\",misses=\"%llu\"}"
+  const CMICmnMIValueConst miValueConstHits(
+      CMIUtilString::FormatTyped("%llu", m_nPathCacheHits));
+  const CMICmnMIValueResult miValueResultHits("hits", miValueConstHits);
+  CMICmnMIValueTuple miValueTuple(miValueResultHits);
+  const CMICmnMIValueConst miValueConstMisses(
+      CMIUtilString::FormatTyped("%llu", m_nPathCacheMisses));
+  const CMICmnMIValueResult miValueResultMisses("misses", miValueConstMisses);
+  miValueTuple.Add(miValueResultMisses);
+  const CMICmnMIValueResult miValueResultPath("path-cache", miValueTuple);
+  miRecordResult.Add(miValueResultPath);
+
+  // MI print "varobjs={count=\"%llu\",bytes=\"%llu\",evicted=\"%llu\"}"
+  const CMICmnMIValueConst miValueConstCount(
+      CMIUtilString::FormatTyped("%llu", m_nVarObjs));
+  const CMICmnMIValueResult miValueResultCount("count", miValueConstCount);
+  CMICmnMIValueTuple miValueTupleVarObjs(miValueResultCount);
+  const CMICmnMIValueConst miValueConstBytes(
+      CMIUtilString::FormatTyped("%llu", m_nVarObjBytes));
+  const CMICmnMIValueResult miValueResultBytes("bytes", miValueConstBytes);
+  miValueTupleVarObjs.Add(miValueResultBytes);
+  const CMICmnMIValueConst miValueConstEvicted(
+      CMIUtilString::FormatTyped("%llu", m_nVarObjsEvicted));
+  const CMICmnMIValueResult miValueResultEvicted("evicted",
+                                                 miValueConstEvicted);
+  miValueTupleVarObjs.Add(miValueResultEvicted);
+  const CMICmnMIValueResult miValueResultVarObjs("varobjs",
+                                                 miValueTupleVarObjs);
+  miRecordResult.Add(miValueResultVarObjs);
+
+  // MI print "stdout={records=\"%llu\",writes=\"%llu\",
+  //           write={p50=\"%llu\",p99=\"%llu\",max=\"%llu\"}}"
+  const CMICmnMIValueConst miValueConstRecords(
+      CMIUtilString::FormatTyped("%llu", m_nStdoutRecords));
+  const CMICmnMIValueResult miValueResultRecords("records",
+                                                 miValueConstRecords);
+  CMICmnMIValueTuple miValueTupleStdout(miValueResultRecords);
+  const CMICmnMIValueConst miValueConstWrites(
+      CMIUtilString::FormatTyped("%llu", m_nStdoutWrites));
+  const CMICmnMIValueResult miValueResultWrites("writes", miValueConstWrites);
+  miValueTupleStdout.Add(miValueResultWrites);
+  const CMICmnMIValueConst miValueConstP50(CMIUtilString::FormatTyped(
+      "%llu", m_histStdoutWriteNs.GetPercentile(50)));
+  const CMICmnMIValueResult miValueResultP50("p50", miValueConstP50);
+  CMICmnMIValueTuple miValueTupleWrite(miValueResultP50);
+  const CMICmnMIValueConst miValueConstP99(CMIUtilString::FormatTyped(
+      "%llu", m_histStdoutWriteNs.GetPercentile(99)));
+  const CMICmnMIValueResult miValueResultP99("p99", miValueConstP99);
+  miValueTupleWrite.Add(miValueResultP99);
+  const CMICmnMIValueConst miValueConstMax(
+      CMIUtilString::FormatTyped("%llu", m_histStdoutWriteNs.GetMax()));
+  const CMICmnMIValueResult miValueResultMax("max", miValueConstMax);
+  miValueTupleWrite.Add(miValueResultMax);
+  const CMICmnMIValueResult miValueResultWrite("write", miValueTupleWrite);
+  miValueTupleStdout.Add(miValueResultWrite);
+  const CMICmnMIValueResult miValueResultStdout("stdout", miValueTupleStdout);
+  miRecordResult.Add(miValueResultStdout);
+  m_miResultRecord = miRecordResult;
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Required by the CMICmdFactory when registering *this command. The
+// factory
+//          calls this function to create an instance of *this command.
+// Type:    Static method.
+// Args:    None.
+// Return:  CMICmdBase * - Pointer to a new command.
+// Throws:  None.
+//--
+CMICmdBase *CMICmdCmdLldbMiStats::CreateSelf() {
+  return new CMICmdCmdLldbMiStats();
+}
+
+//++
+// Details: CMICmdCmdLldbMiBatchBegin constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdCmdLldbMiBatchBegin::CMICmdCmdLldbMiBatchBegin() {
+  // Command factory matches this name with that received from the stdin stream
+  m_strMiCmd = "lldb-mi-batch-begin";
+
+  // Required by the CMICmdFactory when registering *this command
+  m_pSelfCreatorFn = &CMICmdCmdLldbMiBatchBegin::CreateSelf;
+}
+
+//++
+// Details: CMICmdCmdLldbMiBatchBegin destructor.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdCmdLldbMiBatchBegin::~CMICmdCmdLldbMiBatchBegin() {}
+
+//++
+// Details: The invoker requires this function. The command does work in this
+// function.
+//          The driver runs the batch, nothing more is done here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdLldbMiBatchBegin::Execute() {
+  // Do nothing
+  return MIstatus::success;
+}
+
+//++
+// Details: The invoker requires this function. The command prepares a MI Record
+// Result
+//          for the work carried out in the Execute().
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdLldbMiBatchBegin::Acknowledge() {
+  const CMICmnMIResultRecord miRecordResult(
+      m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done);
+  m_miResultRecord = miRecordResult;
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Required by the CMICmdFactory when registering *this command. The
+// factory
+//          calls this function to create an instance of *this command.
+// Type:    Static method.
+// Args:    None.
+// Return:  CMICmdBase * - Pointer to a new command.
+// Throws:  None.
+//--
+CMICmdBase *CMICmdCmdLldbMiBatchBegin::CreateSelf() {
+  return new CMICmdCmdLldbMiBatchBegin();
+}
+
+//++
+// Details: CMICmdCmdLldbMiBatchEnd constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdCmdLldbMiBatchEnd::CMICmdCmdLldbMiBatchEnd() {
+  // Command factory matches this name with that received from the stdin stream
+  m_strMiCmd = "lldb-mi-batch-end";
+
+  // Required by the CMICmdFactory when registering *this command
+  m_pSelfCreatorFn = &CMICmdCmdLldbMiBatchEnd::CreateSelf;
+}
+
+//++
+// Details: CMICmdCmdLldbMiBatchEnd destructor.
+// Type:    Overrideable.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdCmdLldbMiBatchEnd::~CMICmdCmdLldbMiBatchEnd() {}
+
+//++
+// Details: The invoker requires this function. The command does work in this
+// function.
+//          The driver runs the batch, nothing more is done here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdLldbMiBatchEnd::Execute() {
+  // Do nothing
+  return MIstatus::success;
+}
+
+//++
+// Details: The invoker requires this function. The command prepares a MI Record
+// Result
+//          for the work carried out in the Execute().
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdLldbMiBatchEnd::Acknowledge() {
+  const CMICmnMIResultRecord miRecordResult(
+      m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done);
+  m_miResultRecord = miRecordResult;
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Required by the CMICmdFactory when registering *this command. The
+// factory
+//          calls this function to create an instance of *this command.
+// Type:    Static method.
+// Args:    None.
+// Return:  CMICmdBase * - Pointer to a new command.
+// Throws:  None.
+//--
+CMICmdBase *CMICmdCmdLldbMiBatchEnd::CreateSelf() {
+  return new CMICmdCmdLldbMiBatchEnd();
+}
@@ -10,6 +10,7 @@
 //              CMICmdCmdListThreadGroups       interface.
 //              CMICmdCmdInterpreterExec        interface.
 //              CMICmdCmdInferiorTtySet         interface.
+//              CMICmdCmdLldbMiStats            interface.
 //
 //              To implement new MI commands derive a new command class from the
 //              command base
@@ -32,6 +33,7 @@
 #include "MICmdBase.h"
 #include "MICmnMIValueList.h"
 #include "MICmnMIValueTuple.h"
+#include "MIUtilHistogram.h"
 
 //++
 //============================================================================
@@ -53,6 +55,7 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdGdbExit() override;
 };
@@ -79,7 +82,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdListThreadGroups() override;
 
@@ -120,7 +124,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdInterpreterExec() override;
 
@@ -151,6 +156,101 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
+  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdInferiorTtySet() override;
 };
+
+//++
+//============================================================================
+// Details: MI command class. MI commands derived from the command base class.
+//          *this class implements MI command "lldb-mi-stats".
+//          Gives the latency statistics the Invoker gathers for each MI
+//          command. This command is an lldb-mi extension.
+//--
+class CMICmdCmdLldbMiStats : public CMICmdBase {
+  // Statics:
+public:
+  // Required by the CMICmdFactory when registering *this command
+  static CMICmdBase *CreateSelf();
+
+  // Methods:
+public:
+  /* ctor */ CMICmdCmdLldbMiStats();
+
+  // Overridden:
+public:
+  // From CMICmdInvoker::ICmd
+  bool Execute() override;
+  bool Acknowledge() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
+  // From CMICmnBase
+  /* dtor */ ~CMICmdCmdLldbMiStats() override;
+
+  // Attributes:
+private:
+  const CMIUtilString m_constStrArgNamedReset;
+  CMIUtilString m_strStats; // MI list of the statistics
+  MIuint64 m_nPathCacheHits;   // Source paths resolved from the session cache
+  MIuint64 m_nPathCacheMisses; // Source paths searched for
+  MIuint64 m_nVarObjs;         // Var objects kept
+  MIuint64 m_nVarObjBytes;     // Memory taken by the var objects kept
+  MIuint64 m_nVarObjsEvicted;  // Var objects deleted to keep to the limit
+  MIuint64 m_nStdoutRecords;   // Texts sent to stdout
+  MIuint64 m_nStdoutWrites;    // Writes made to stdout to send them
+  CMIUtilHistogram m_histStdoutWriteNs; // Time taken by those writes
+};
+
+//++
+//============================================================================
+// Details: MI command class. MI commands derived from the command base class.
+//          *this class implements MI command "lldb-mi-batch-begin".
+//          Opens a batch, the driver runs the commands up to the next
+//          "lldb-mi-batch-end" back to back and writes their records out
+//          together. This command is an lldb-mi extension.
+//--
+class CMICmdCmdLldbMiBatchBegin : public CMICmdBase {
+  // Statics:
+public:
+  // Required by the CMICmdFactory when registering *this command
+  static CMICmdBase *CreateSelf();
+
+  // Methods:
+public:
+  /* ctor */ CMICmdCmdLldbMiBatchBegin();
+
+  // Overridden:
+public:
+  // From CMICmdInvoker::ICmd
+  bool Execute() override;
+  bool Acknowledge() override;
+  // From CMICmnBase
+  /* dtor */ ~CMICmdCmdLldbMiBatchBegin() override;
+};
+
+//++
+//============================================================================
+// Details: MI command class. MI commands derived from the command base class.
+//          *this class implements MI command "lldb-mi-batch-end".
+//          Closes the batch opened by "lldb-mi-batch-begin". This command is
+//          an lldb-mi extension.
+//--
+class CMICmdCmdLldbMiBatchEnd : public CMICmdBase {
+  // Statics:
+public:
+  // Required by the CMICmdFactory when registering *this command
+  static CMICmdBase *CreateSelf();
+
+  // Methods:
+public:
+  /* ctor */ CMICmdCmdLldbMiBatchEnd();
+
+  // Overridden:
+public:
+  // From CMICmdInvoker::ICmd
+  bool Execute() override;
+  bool Acknowledge() override;
+  // From CMICmnBase
+  /* dtor */ ~CMICmdCmdLldbMiBatchEnd() override;
+};
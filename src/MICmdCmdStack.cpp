@@ -29,6 +29,7 @@
 #include "MICmnLLDBDebugger.h"
 #include "MICmnMIOutOfBandRecord.h"
 #include "MICmnMIResultRecord.h"
+#include "MICmnMIValueBuilder.h"
 #include "MICmnMIValueConst.h"
 
 #include <algorithm>
@@ -73,6 +74,9 @@ CMICmdCmdStackInfoDepth::CMICmdCmdStackInfoDepth()
 
   // Required by the CMICmdFactory when registering *this command
   m_pSelfCreatorFn = &CMICmdCmdStackInfoDepth::CreateSelf;
+
+  // Finished commands are kept by the CMICmdFactory and reused
+  m_bReusable = true;
 }
 
 //++
@@ -85,18 +89,30 @@ CMICmdCmdStackInfoDepth::CMICmdCmdStackInfoDepth()
 CMICmdCmdStackInfoDepth::~CMICmdCmdStackInfoDepth() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Return *this command to the state it was created in so it can be
+//          reused.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdCmdStackInfoDepth::ParseArgs() {
-  m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgMaxDepth, false, false));
-  return ParseValidateCmdOptions();
+bool CMICmdCmdStackInfoDepth::Reset() {
+  m_nThreadFrames = 0;
+
+  return CMICmdBase::Reset();
+}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdStackInfoDepth::DeclareArgs() {
+  m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgMaxDepth, false, true));
 }
 
 //++
@@ -130,6 +146,22 @@ bool CMICmdCmdStackInfoDepth::Execute() {
   lldb::SBThread thread = (nThreadId != UINT64_MAX)
                               ? sbProcess.GetThreadByIndexID(nThreadId)
                               : sbProcess.GetSelectedThread();
+
+  // Counting the frames unwinds the whole stack, with a maximum depth the
+  // stack need only be unwound that far to know it is at least that deep
+  if (pArgMaxDepth->GetFound()) {
+    const MIint64 nMaxDepth = pArgMaxDepth->GetValue();
+    if (nMaxDepth <= 0) {
+      m_nThreadFrames = 0;
+      return MIstatus::success;
+    }
+    if ((nMaxDepth <= UINT32_MAX) &&
+        thread.GetFrameAtIndex(static_cast<uint32_t>(nMaxDepth - 1))
+            .IsValid()) {
+      m_nThreadFrames = static_cast<MIuint>(nMaxDepth);
+      return MIstatus::success;
+    }
+  }
   m_nThreadFrames = thread.GetNumFrames();
 
   return MIstatus::success;
@@ -146,7 +178,8 @@ bool CMICmdCmdStackInfoDepth::Execute() {
 // Throws:  None.
 //--
 bool CMICmdCmdStackInfoDepth::Acknowledge() {
-  const CMIUtilString strDepth(CMIUtilString::Format("%d", m_nThreadFrames));
+  const CMIUtilString strDepth(
+      CMIUtilString::FormatTyped("%d", m_nThreadFrames));
   const CMICmnMIValueConst miValueConst(strDepth);
   const CMICmnMIValueResult miValueResult("depth", miValueConst);
   const CMICmnMIResultRecord miRecordResult(
@@ -194,18 +227,6 @@ CMICmdCmdStackInfoFrame::CMICmdCmdStackInfoFrame() {
 //--
 CMICmdCmdStackInfoFrame::~CMICmdCmdStackInfoFrame() {}
 
-//++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
-// Type:    Overridden.
-// Args:    None.
-// Return:  MIstatus::success - Function succeeded.
-//          MIstatus::failure - Function failed.
-// Throws:  None.
-//--
-bool CMICmdCmdStackInfoFrame::ParseArgs() { return ParseValidateCmdOptions(); }
-
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -279,13 +300,16 @@ CMICmdBase *CMICmdCmdStackInfoFrame::CreateSelf() {
 // Throws:  None.
 //--
 CMICmdCmdStackListFrames::CMICmdCmdStackListFrames()
-    : m_nThreadFrames(0), m_constStrArgFrameLow("low-frame"),
+    : m_nFrames(0), m_constStrArgFrameLow("low-frame"),
       m_constStrArgFrameHigh("high-frame") {
   // Command factory matches this name with that received from the stdin stream
   m_strMiCmd = "stack-list-frames";
 
   // Required by the CMICmdFactory when registering *this command
   m_pSelfCreatorFn = &CMICmdCmdStackListFrames::CreateSelf;
+
+  // Finished commands are kept by the CMICmdFactory and reused
+  m_bReusable = true;
 }
 
 //++
@@ -295,24 +319,35 @@ CMICmdCmdStackListFrames::CMICmdCmdStackListFrames()
 // Return:  None.
 // Throws:  None.
 //--
-CMICmdCmdStackListFrames::~CMICmdCmdStackListFrames() {
-  m_vecMIValueResult.clear();
-}
+CMICmdCmdStackListFrames::~CMICmdCmdStackListFrames() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Return *this command to the state it was created in so it can be
+//          reused.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdCmdStackListFrames::ParseArgs() {
+bool CMICmdCmdStackListFrames::Reset() {
+  m_nFrames = 0;
+  m_strFrames.clear();
+
+  return CMICmdBase::Reset();
+}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdStackListFrames::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgFrameLow, false, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgFrameHigh, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -341,11 +376,15 @@ bool CMICmdCmdStackListFrames::Execute() {
     return MIstatus::failure;
   }
 
-  // Frame low and high options are not mandatory
-  MIuint nFrameHigh =
+  // Frame low and high options are not mandatory. Frame indexes are 32 bit,
+  // levels outside that range are clamped to it rather than wrapped.
+  MIint64 nFrameHigh =
       pArgFrameHigh->GetFound() ? pArgFrameHigh->GetValue() : UINT32_MAX;
-  const MIuint nFrameLow =
-      pArgFrameLow->GetFound() ? pArgFrameLow->GetValue() : 0;
+  MIint64 nFrameLow = pArgFrameLow->GetFound() ? pArgFrameLow->GetValue() : 0;
+  if (nFrameHigh > UINT32_MAX)
+    nFrameHigh = UINT32_MAX;
+  if (nFrameLow < 0)
+    nFrameLow = 0;
 
   CMICmnLLDBDebugSessionInfo &rSessionInfo(
       CMICmnLLDBDebugSessionInfo::Instance());
@@ -353,32 +392,30 @@ bool CMICmdCmdStackListFrames::Execute() {
   lldb::SBThread thread = (nThreadId != UINT64_MAX)
                               ? sbProcess.GetThreadByIndexID(nThreadId)
                               : sbProcess.GetSelectedThread();
-  MIuint nThreadFrames = thread.GetNumFrames();
-
-  // Adjust nThreadFrames for the nFrameHigh argument as we use nFrameHigh+1 in
-  // the min calc as the arg
-  // is not an index, but a frame id value.
-  if (nFrameHigh < UINT32_MAX) {
-    nFrameHigh++;
-    nThreadFrames = (nFrameHigh < nThreadFrames) ? nFrameHigh : nThreadFrames;
-  }
 
-  m_nThreadFrames = nThreadFrames;
-  if (nThreadFrames == 0)
-    return MIstatus::success;
+  // Frames are taken one at a time until the high frame or the end of the
+  // stack so the stack is unwound no further than asked for. The frames are
+  // formed straight into the list given in the result record.
+  m_nFrames = 0;
+  m_strFrames.clear();
+  CMICmnMIValueBuilder builder(m_strFrames);
+  builder.OpenList();
+  for (MIint64 nLevel = nFrameLow; nLevel <= nFrameHigh; nLevel++) {
+    if (!thread.GetFrameAtIndex(static_cast<uint32_t>(nLevel)).IsValid())
+      break;
 
-  m_vecMIValueResult.clear();
-  for (MIuint nLevel = nFrameLow; nLevel < nThreadFrames; nLevel++) {
     CMICmnMIValueTuple miValueTuple;
     if (!rSessionInfo.MIResponseFormFrameInfo(
-            thread, nLevel,
+            thread, static_cast<MIuint>(nLevel),
             CMICmnLLDBDebugSessionInfo::eFrameInfoFormat_NoArguments,
             miValueTuple))
       return MIstatus::failure;
 
-    const CMICmnMIValueResult miValueResult8("frame", miValueTuple);
-    m_vecMIValueResult.push_back(miValueResult8);
+    builder.Result("frame");
+    builder.Value(miValueTuple.GetString());
+    ++m_nFrames;
   }
+  builder.CloseList();
 
   return MIstatus::success;
 }
@@ -394,7 +431,7 @@ bool CMICmdCmdStackListFrames::Execute() {
 // Throws:  None.
 //--
 bool CMICmdCmdStackListFrames::Acknowledge() {
-  if (m_nThreadFrames == 0) {
+  if (m_nFrames == 0) {
     // MI print "3^done,stack=[{}]"
     const CMICmnMIValueTuple miValueTuple;
     const CMICmnMIValueList miValueList(miValueTuple);
@@ -407,29 +444,9 @@ bool CMICmdCmdStackListFrames::Acknowledge() {
     return MIstatus::success;
   }
 
-  // Build up a list of thread information from tuples
-  VecMIValueResult_t::const_iterator it = m_vecMIValueResult.begin();
-  if (it == m_vecMIValueResult.end()) {
-    // MI print "3^done,stack=[{}]"
-    const CMICmnMIValueTuple miValueTuple;
-    const CMICmnMIValueList miValueList(miValueTuple);
-    const CMICmnMIValueResult miValueResult("stack", miValueList);
-    const CMICmnMIResultRecord miRecordResult(
-        m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
-        miValueResult);
-    m_miResultRecord = miRecordResult;
-    return MIstatus::success;
-  }
-  CMICmnMIValueList miValueList(*it);
-  ++it;
-  while (it != m_vecMIValueResult.end()) {
-    const CMICmnMIValueResult &rTuple(*it);
-    miValueList.Add(rTuple);
-
-    // Next
-    ++it;
-  }
-  const CMICmnMIValueResult miValueResult("stack", miValueList);
+  // MI print "3^done,stack=[frame={...},frame={...},...]"
+  const CMICmnMIValueConst miValueConst(m_strFrames, true);
+  const CMICmnMIValueResult miValueResult("stack", miValueConst);
   const CMICmnMIResultRecord miRecordResult(
       m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
       miValueResult);
@@ -479,21 +496,18 @@ CMICmdCmdStackListArguments::CMICmdCmdStackListArguments()
 CMICmdCmdStackListArguments::~CMICmdCmdStackListArguments() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdStackListArguments::ParseArgs() {
+void CMICmdCmdStackListArguments::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValPrintValues(m_constStrArgPrintValues, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgFrameLow, false, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgFrameHigh, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -575,7 +589,7 @@ bool CMICmdCmdStackListArguments::Execute() {
     if (!rSessionInfo.MIResponseFormVariableInfo(frame, maskVarTypes,
                                                  eVarInfoFormat, miValueList))
       return MIstatus::failure;
-    const CMICmnMIValueConst miValueConst(CMIUtilString::Format("%d", i));
+    const CMICmnMIValueConst miValueConst(CMIUtilString::FormatTyped("%d", i));
     const CMICmnMIValueResult miValueResult("level", miValueConst);
     CMICmnMIValueTuple miValueTuple(miValueResult);
     const CMICmnMIValueResult miValueResult2("args", miValueList);
@@ -660,19 +674,16 @@ CMICmdCmdStackListLocals::CMICmdCmdStackListLocals()
 CMICmdCmdStackListLocals::~CMICmdCmdStackListLocals() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdStackListLocals::ParseArgs() {
+void CMICmdCmdStackListLocals::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValPrintValues(m_constStrArgPrintValues, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -809,6 +820,9 @@ CMICmdCmdStackListVariables::CMICmdCmdStackListVariables()
 
   // Required by the CMICmdFactory when registering *this command
   m_pSelfCreatorFn = &CMICmdCmdStackListVariables::CreateSelf;
+
+  // Finished commands are kept by the CMICmdFactory and reused
+  m_bReusable = true;
 }
 
 //++
@@ -821,19 +835,32 @@ CMICmdCmdStackListVariables::CMICmdCmdStackListVariables()
 CMICmdCmdStackListVariables::~CMICmdCmdStackListVariables() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Return *this command to the state it was created in so it can be
+//          reused.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdCmdStackListVariables::ParseArgs() {
+bool CMICmdCmdStackListVariables::Reset() {
+  m_bThreadInvalid = false;
+  m_miValueList = CMICmnMIValueList(true);
+
+  return CMICmdBase::Reset();
+}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdStackListVariables::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValPrintValues(m_constStrArgPrintValues, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -980,18 +1007,15 @@ CMICmdCmdStackSelectFrame::CMICmdCmdStackSelectFrame()
 CMICmdCmdStackSelectFrame::~CMICmdCmdStackSelectFrame() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Function succeeded.
-//          MIstatus::failure - Function failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdStackSelectFrame::ParseArgs() {
+void CMICmdCmdStackSelectFrame::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgFrameId, true, false));
-  return ParseValidateCmdOptions();
 }
 
 //++
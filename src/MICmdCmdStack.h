@@ -52,14 +52,16 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
+  bool Reset() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackInfoDepth() override;
 
   // Attributes:
 private:
   MIuint m_nThreadFrames;
-  const CMIUtilString m_constStrArgMaxDepth; // Not handled by *this command
+  const CMIUtilString m_constStrArgMaxDepth;
 };
 
 //++
@@ -82,7 +84,6 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackInfoFrame() override;
 
@@ -111,18 +112,16 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
+  bool Reset() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackListFrames() override;
 
-  // Typedefs:
-private:
-  typedef std::vector<CMICmnMIValueResult> VecMIValueResult_t;
-
   // Attributes:
 private:
-  MIuint m_nThreadFrames;
-  VecMIValueResult_t m_vecMIValueResult;
+  MIuint m_nFrames;          // Number of frames in m_strFrames
+  CMIUtilString m_strFrames; // MI list of the frames' results
   const CMIUtilString m_constStrArgFrameLow;
   const CMIUtilString m_constStrArgFrameHigh;
 };
@@ -147,7 +146,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackListArguments() override;
 
@@ -181,7 +181,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackListLocals() override;
 
@@ -213,7 +214,9 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
+  bool Reset() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackListVariables() override;
 
@@ -245,7 +248,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdStackSelectFrame() override;
 
@@ -15,6 +15,7 @@
 #include "MICmnMIResultRecord.h"
 #include "MICmnMIValueConst.h"
 #include "MICmnMIValueTuple.h"
+#include "MICmnResources.h"
 
 //++
 // Details: CMICmdCmdSupportInfoMiCmdQuery constructor.
@@ -24,7 +25,8 @@
 // Throws:  None.
 //--
 CMICmdCmdSupportInfoMiCmdQuery::CMICmdCmdSupportInfoMiCmdQuery()
-    : m_bCmdFound(false), m_constStrArgCmdName("cmd_name") {
+    : m_bCmdFound(false), m_constStrArgCmdName("cmd_name"),
+      m_miValueListArgs(true) {
   // Command factory matches this name with that received from the stdin stream
   m_strMiCmd = "info-gdb-mi-command";
 
@@ -42,18 +44,15 @@ CMICmdCmdSupportInfoMiCmdQuery::CMICmdCmdSupportInfoMiCmdQuery()
 CMICmdCmdSupportInfoMiCmdQuery::~CMICmdCmdSupportInfoMiCmdQuery() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdSupportInfoMiCmdQuery::ParseArgs() {
+void CMICmdCmdSupportInfoMiCmdQuery::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgCmdName, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -71,11 +70,40 @@ bool CMICmdCmdSupportInfoMiCmdQuery::Execute() {
   CMICMDBASE_GETOPTION(pArgNamedCmdName, String, m_constStrArgCmdName);
   const CMIUtilString &rCmdToQuery(pArgNamedCmdName->GetValue());
   const MIuint nLen = rCmdToQuery.length();
-  const CMICmdFactory &rCmdFactory = CMICmdFactory::Instance();
-  if ((nLen > 1) && (rCmdToQuery[0] == '-'))
-    m_bCmdFound = rCmdFactory.CmdExist(rCmdToQuery.substr(1, nLen - 1).c_str());
-  else
-    m_bCmdFound = rCmdFactory.CmdExist(rCmdToQuery);
+  const CMIUtilString strCmdName(
+      ((nLen > 1) && (rCmdToQuery[0] == '-'))
+          ? CMIUtilString(rCmdToQuery.substr(1, nLen - 1))
+          : rCmdToQuery);
+  m_bCmdFound = CMICmdFactory::Instance().CmdExist(strCmdName);
+  m_miValueListArgs = CMICmnMIValueList(true);
+  if (!m_bCmdFound)
+    return MIstatus::success;
+
+  return GetCmdArgs(strCmdName);
+}
+
+//++
+// Details: Form the list of arguments a command takes. An instance of the
+//          command is made so it declares its arguments, see
+//          CMICmdArgSet::GetArgsMIList().
+// Type:    Method.
+// Args:    vCmdName    - (R) MI command name without the leading '-'.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdSupportInfoMiCmdQuery::GetCmdArgs(const CMIUtilString &vCmdName) {
+  CMICmdFactory &rCmdFactory = CMICmdFactory::Instance();
+  CMICmdBase *pCmd = nullptr;
+  if (!rCmdFactory.CmdCreate(vCmdName, SMICmdData(), pCmd)) {
+    SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_FNFAILED),
+                                   m_cmdData.strMiCmd.c_str(), "CmdCreate"));
+    return MIstatus::failure;
+  }
+
+  pCmd->AddArgs();
+  pCmd->GetArgSet().GetArgsMIList(m_miValueListArgs);
+  rCmdFactory.CmdRelease(pCmd);
 
   return MIstatus::success;
 }
@@ -93,7 +121,9 @@ bool CMICmdCmdSupportInfoMiCmdQuery::Execute() {
 bool CMICmdCmdSupportInfoMiCmdQuery::Acknowledge() {
   const CMICmnMIValueConst miValueConst(m_bCmdFound ? "true" : "false");
   const CMICmnMIValueResult miValueResult("exists", miValueConst);
-  const CMICmnMIValueTuple miValueTuple(miValueResult);
+  CMICmnMIValueTuple miValueTuple(miValueResult);
+  if (m_bCmdFound)
+    miValueTuple.Add(CMICmnMIValueResult("args", m_miValueListArgs));
   const CMICmnMIValueResult miValueResult2("command", miValueTuple);
   const CMICmnMIResultRecord miRecordResult(
       m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
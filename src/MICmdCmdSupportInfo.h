@@ -24,12 +24,15 @@
 
 // In-house headers:
 #include "MICmdBase.h"
+#include "MICmnMIValueList.h"
 
 //++
 //============================================================================
 // Details: MI command class. MI commands derived from the command base class.
 //          *this class implements MI command "info-gdb-mi-command".
-//          This command does not follow the MI documentation exactly.
+//          This command does not follow the MI documentation exactly. It
+//          also gives the arguments the command takes, in the order they are
+//          parsed, with each argument's kind.
 //--
 class CMICmdCmdSupportInfoMiCmdQuery : public CMICmdBase {
   // Statics:
@@ -46,13 +49,19 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdSupportInfoMiCmdQuery() override;
 
+  // Methods:
+private:
+  bool GetCmdArgs(const CMIUtilString &vCmdName);
+
   // Attributes:
 private:
   bool m_bCmdFound; // True = query for the command in command factory found,
                     // false = not found not recognised
   const CMIUtilString m_constStrArgCmdName;
+  CMICmnMIValueList m_miValueListArgs; // The arguments the command takes
 };
@@ -38,6 +38,16 @@ CMICmdCmdSupportListFeatures::CMICmdCmdSupportListFeatures() {
 //--
 CMICmdCmdSupportListFeatures::~CMICmdCmdSupportListFeatures() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdSupportListFeatures::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
@@ -70,11 +80,16 @@ bool CMICmdCmdSupportListFeatures::Acknowledge() {
   const CMICmnMIValueConst miValueConst1("data-read-memory-bytes");
   const CMICmnMIValueConst miValueConst2("exec-run-start-option");
   const CMICmnMIValueConst miValueConst3("pending-breakpoints");
+  // -data-read/write-memory-bytes --encoding base64|rle
+  const CMICmnMIValueConst miValueConst4("data-memory-bytes-base64");
+  const CMICmnMIValueConst miValueConst5("data-memory-bytes-rle");
   // Some features may depend on host and/or target, decide what to add below
   CMICmnMIValueList miValueList(true);
   miValueList.Add(miValueConst1);
   miValueList.Add(miValueConst2);
   miValueList.Add(miValueConst3);
+  miValueList.Add(miValueConst4);
+  miValueList.Add(miValueConst5);
   const CMICmnMIValueResult miValueResult("features", miValueList);
   const CMICmnMIResultRecord miRecordResult(
       m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
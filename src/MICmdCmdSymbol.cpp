@@ -67,18 +67,15 @@ CMICmdCmdSymbolListLines::CMICmdCmdSymbolListLines()
 CMICmdCmdSymbolListLines::~CMICmdCmdSymbolListLines() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdSymbolListLines::ParseArgs() {
+void CMICmdCmdSymbolListLines::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValFile(m_constStrArgNameFile, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
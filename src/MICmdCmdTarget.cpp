@@ -51,20 +51,17 @@ CMICmdCmdTargetSelect::CMICmdCmdTargetSelect()
 CMICmdCmdTargetSelect::~CMICmdCmdTargetSelect() = default;
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdTargetSelect::ParseArgs() {
+void CMICmdCmdTargetSelect::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgNamedType, true, true));
   m_setCmdArgs.Add(
       new CMICmdArgValString(m_constStrArgNamedParameters, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -221,23 +218,20 @@ CMICmdCmdTargetAttach::CMICmdCmdTargetAttach()
 CMICmdCmdTargetAttach::~CMICmdCmdTargetAttach() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdTargetAttach::ParseArgs() {
+void CMICmdCmdTargetAttach::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgPid, false, true));
   m_setCmdArgs.Add(
       new CMICmdArgValOptionShort(m_constStrArgNamedFile, false, true,
                                   CMICmdArgValListBase::eArgValType_String, 1));
   m_setCmdArgs.Add(
       new CMICmdArgValOptionLong(m_constStrArgWaitFor, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -35,6 +35,9 @@ CMICmdCmdThreadInfo::CMICmdCmdThreadInfo()
 
   // Required by the CMICmdFactory when registering *this command
   m_pSelfCreatorFn = &CMICmdCmdThreadInfo::CreateSelf;
+
+  // Finished commands are kept by the CMICmdFactory and reused
+  m_bReusable = true;
 }
 
 //++
@@ -47,19 +50,36 @@ CMICmdCmdThreadInfo::CMICmdCmdThreadInfo()
 CMICmdCmdThreadInfo::~CMICmdCmdThreadInfo() { m_vecMIValueTuple.clear(); }
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Return *this command to the state it was created in so it can be
+//          reused.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdCmdThreadInfo::ParseArgs() {
+bool CMICmdCmdThreadInfo::Reset() {
+  m_miValueTupleThread = CMICmnMIValueTuple();
+  m_bSingleThread = false;
+  m_bThreadInvalid = true;
+  m_vecMIValueTuple.clear();
+  m_bHasCurrentThread = false;
+  m_miValueCurrThreadId = CMICmnMIValue();
+
+  return CMICmdBase::Reset();
+}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdThreadInfo::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValNumber(m_constStrArgNamedThreadId, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -236,19 +256,16 @@ CMICmdCmdThreadSelect::CMICmdCmdThreadSelect()
 CMICmdCmdThreadSelect::~CMICmdCmdThreadSelect() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdThreadSelect::ParseArgs() {
+void CMICmdCmdThreadSelect::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValNumber(m_constStrArgNamedThreadId, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -37,6 +37,16 @@ CMICmdCmdTraceStatus::CMICmdCmdTraceStatus() {
 //--
 CMICmdCmdTraceStatus::~CMICmdCmdTraceStatus() {}
 
+//++
+// Details: The invoker requires this function. *this command takes its options
+//          without checking them so nothing is parsed here.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+// Throws:  None.
+//--
+bool CMICmdCmdTraceStatus::ParseArgs() { return MIstatus::success; }
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
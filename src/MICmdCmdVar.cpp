@@ -39,6 +39,8 @@
 #include "MICmnMIValueConst.h"
 
 #include <algorithm>
+#include <tuple>
+#include <vector>
 
 namespace {
 
@@ -47,8 +49,8 @@ CMIUtilString GetMemberName(const CMIUtilString &parentName,
                             const CMIUtilString &memberName,
                             MIuint memberIndex) {
   if (memberName.empty())
-    return CMIUtilString::Format("%s.$%u", parentName.c_str(), memberIndex);
-  return CMIUtilString::Format("%s.%s", parentName.c_str(), memberName.c_str());
+    return CMIUtilString::FormatTyped("%s.$%u", parentName, memberIndex);
+  return CMIUtilString::FormatTyped("%s.%s", parentName, memberName);
 }
 
 } // namespace
@@ -82,20 +84,17 @@ CMICmdCmdVarCreate::CMICmdCmdVarCreate()
 CMICmdCmdVarCreate::~CMICmdCmdVarCreate() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarCreate::ParseArgs() {
+void CMICmdCmdVarCreate::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, false, true));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgFrameAddr, false, true));
   m_setCmdArgs.Add(new CMICmdArgValText(m_constStrArgExpression, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -150,7 +149,7 @@ bool CMICmdCmdVarCreate::Execute() {
     const CMIUtilString &rArg = pArgName->GetValue();
     const bool bAutoName = (rArg == "-");
     if (bAutoName) {
-      m_strVarName = CMIUtilString::Format(
+      m_strVarName = CMIUtilString::FormatTyped(
           "var%u", CMICmnLLDBDebugSessionInfoVarObj::VarObjIdGet());
       CMICmnLLDBDebugSessionInfoVarObj::VarObjIdInc();
     } else
@@ -190,18 +189,14 @@ bool CMICmdCmdVarCreate::Execute() {
     const CMIUtilString rStrRegister(rStrExpression.substr(1));
     value = frame.FindRegister(rStrRegister.c_str());
   } else {
-    const bool bArgs = true;
-    const bool bLocals = true;
-    const bool bStatics = true;
-    const bool bInScopeOnly = true;
-    const lldb::SBValueList valueList =
-        frame.GetVariables(bArgs, bLocals, bStatics, bInScopeOnly);
-    value = valueList.GetFirstValueByName(rStrExpression.c_str());
+    rSessionInfo.GetFrameVariable(frame, rStrExpression, value);
   }
 
   if (!value.IsValid()) {
     value = frame.EvaluateExpression(rStrExpression.c_str());
     valueObjKind = ValObjKind_ec::eValObjKind_ConstResult;
+    // The expression may have written to the inferior
+    rSessionInfo.SnapshotInvalidate();
   }
 
   if (value.IsValid() && value.GetError().Success()) {
@@ -210,11 +205,11 @@ bool CMICmdCmdVarCreate::Execute() {
     m_nChildren = value.GetNumChildren();
     m_strType = CMICmnLLDBUtilSBValue(value).GetTypeNameDisplay();
 
-    // This gets added to CMICmnLLDBDebugSessionInfoVarObj static container of
-    // varObjs
-    CMICmnLLDBDebugSessionInfoVarObj varObj(rStrExpression, m_strVarName, value,
-                                            valueObjKind);
-    m_strValue = varObj.GetValueFormatted();
+    const CMICmnLLDBDebugSessionInfoVarObj &rVarObj =
+        CMICmnLLDBDebugSessionInfoVarObj::VarObjAdd(
+            CMICmnLLDBDebugSessionInfoVarObj(rStrExpression, m_strVarName,
+                                             value, valueObjKind));
+    m_strValue = rVarObj.GetValueFormatted();
   } else {
     m_strValue = value.GetError().GetCString();
   }
@@ -238,14 +233,16 @@ bool CMICmdCmdVarCreate::Acknowledge() {
     // "%s^done,name=\"%s\",numchild=\"%d\",value=\"%s\",type=\"%s\",thread-id=\"%llu\",has_more=\"%u\""
     const CMICmnMIValueConst miValueConst(m_strVarName);
     CMICmnMIValueResult miValueResultAll("name", miValueConst);
-    const CMIUtilString strNumChild(CMIUtilString::Format("%d", m_nChildren));
+    const CMIUtilString strNumChild(
+        CMIUtilString::FormatTyped("%d", m_nChildren));
     const CMICmnMIValueConst miValueConst2(strNumChild);
     miValueResultAll.Add("numchild", miValueConst2);
     const CMICmnMIValueConst miValueConst3(m_strValue);
     miValueResultAll.Add("value", miValueConst3);
     const CMICmnMIValueConst miValueConst4(m_strType);
     miValueResultAll.Add("type", miValueConst4);
-    const CMIUtilString strThreadId(CMIUtilString::Format("%llu", m_nThreadId));
+    const CMIUtilString strThreadId(
+        CMIUtilString::FormatTyped("%llu", m_nThreadId));
     const CMICmnMIValueConst miValueConst5(strThreadId);
     miValueResultAll.Add("thread-id", miValueConst5);
     const CMICmnMIValueConst miValueConst6("0");
@@ -319,6 +316,9 @@ CMICmdCmdVarUpdate::CMICmdCmdVarUpdate()
 
   // Required by the CMICmdFactory when registering *this command
   m_pSelfCreatorFn = &CMICmdCmdVarUpdate::CreateSelf;
+
+  // Finished commands are kept by the CMICmdFactory and reused
+  m_bReusable = true;
 }
 
 //++
@@ -331,20 +331,33 @@ CMICmdCmdVarUpdate::CMICmdCmdVarUpdate()
 CMICmdCmdVarUpdate::~CMICmdCmdVarUpdate() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Return *this command to the state it was created in so it can be
+//          reused.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdCmdVarUpdate::ParseArgs() {
+bool CMICmdCmdVarUpdate::Reset() {
+  m_bValueChanged = false;
+  m_miValueList = CMICmnMIValueList(true);
+
+  return CMICmdBase::Reset();
+}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdVarUpdate::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValPrintValues(m_constStrArgPrintValues, false, true));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -357,41 +370,36 @@ bool CMICmdCmdVarUpdate::ParseArgs() {
 //          at some point stops expanding nested elements, and this would mean
 //          that at some point complex variable will not have its children
 //          listed with -var-list-children and that will stop recursion.
+//          Only the children listed by -var-list-children are printed
+//          (-var-set-update-range is not supported), the var object keeps
+//          those so the other members of the value are not looked at.
 // Return:  MIstatus::success - Function succeeded.
 //          MIstatus::failure - Function failed.
 //--
 bool CMICmdCmdVarUpdate::PrintValue(
     CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e eVarInfoFormat,
-    lldb::SBValue &value, const CMIUtilString &valueName) {
+    CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj) {
+  lldb::SBValue &value = vrwVarObj.GetValue();
+  const CMIUtilString &valueName(vrwVarObj.GetName());
 
   bool bPrintedChildren = false;
-  if (value.MightHaveChildren()) {
-    // Scan children recursively and print those that changed.
-    const MIuint nChildren = value.GetNumChildren();
-    for (MIuint i = 0; i < nChildren; i++) {
-      lldb::SBValue child = value.GetChildAtIndex(i);
-
-      // Did this child changed its value?
-      bool childValueChanged = false;
-      if (!ExamineSBValueForChange(child, childValueChanged))
-        return MIstatus::failure;
-      if (!childValueChanged)
-        continue;
-
-      // rValue.GetNumChildren() returns all members, but this function should
-      // print only those that has been listed by -var-list-children or
-      // -var-set-update-range. LLDB-MI doens't support the latter, though.
-      // I don't know any better way to check if member has been listed than
-      // to attempt to get the member by its name.
-      const CMIUtilString childName(
-          GetMemberName(valueName, CMICmnLLDBUtilSBValue(child).GetName(), i));
-      CMICmnLLDBDebugSessionInfoVarObj childVarObj;
-      if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(childName, childVarObj))
-        continue;
-
-      PrintValue(eVarInfoFormat, child, childName);
-      bPrintedChildren = true;
-    }
+  // Scan listed children recursively and print those that changed.
+  for (const CMICmnLLDBDebugSessionInfoVarObj::VarObjHandle_t nChild :
+       vrwVarObj.GetChildren()) {
+    CMICmnLLDBDebugSessionInfoVarObj *pChild =
+        CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(nChild);
+    if (pChild == nullptr)
+      continue;
+
+    // Did this child changed its value?
+    bool childValueChanged = false;
+    if (!ExamineSBValueForChange(pChild->GetValue(), childValueChanged))
+      return MIstatus::failure;
+    if (!childValueChanged)
+      continue;
+
+    PrintValue(eVarInfoFormat, *pChild);
+    bPrintedChildren = true;
   }
 
   if (!bPrintedChildren ||
@@ -419,11 +427,146 @@ bool CMICmdCmdVarUpdate::PrintValue(
   return MIstatus::success;
 }
 
+//++
+// Details: Check a var object for a change and print it, or the children of it
+//          that changed, into the changelist response.
+// Type:    Method.
+// Args:    eVarInfoFormat  - (R) Which values to print.
+//          vrwVarObj       - (RW) The var object.
+//          vrFrame         - (R) The selected frame, expression results are
+//                            evaluated again in it.
+//          vbAll           - (R) True = updating all the var objects, a var
+//                            object that cannot be checked is skipped, false
+//                            = it is an error.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdVarUpdate::UpdateVarObj(
+    CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e eVarInfoFormat,
+    CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj, lldb::SBFrame &vrFrame,
+    const bool vbAll) {
+  lldb::SBValue &rValue = vrwVarObj.GetValue();
+  const bool bVarChanged = vrwVarObj.ExchangeChanged(false);
+  bool bValueChanged = false;
+  if (!ExamineSBValueForChange(rValue, bValueChanged))
+    return MIstatus::failure;
+
+  // SBValue changed state due to a -var-assign may have already been
+  // cleared so combine it with changed state held by the var object
+  bValueChanged |= bVarChanged;
+
+  if (!bValueChanged) {
+    if (!vrFrame.IsValid()) {
+      if (vbAll)
+        return MIstatus::success;
+      SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_FRAME_INVALID),
+                                     m_constStrArgFrame.c_str()));
+      return MIstatus::failure;
+    }
+
+    const auto valObjKind = vrwVarObj.GetValObjKind();
+    if (valObjKind == ValObjKind_ec::eValObjKind_ConstResult) {
+      // This is likely an expression result and it should be re-evaluated.
+
+      auto tmpValue =
+          vrFrame.EvaluateExpression(vrwVarObj.GetNameReal().c_str());
+      if (tmpValue.IsValid() && tmpValue.GetError().Success()) {
+        bValueChanged = true;
+        rValue = std::move(tmpValue);
+      }
+    }
+  }
+
+  if (!bValueChanged)
+    return MIstatus::success;
+
+  m_bValueChanged = true;
+  vrwVarObj.UpdateValue();
+  return PrintValue(eVarInfoFormat, vrwVarObj);
+}
+
+//++
+// Details: Check all the var objects for changes, -var-update *. The root var
+//          objects are taken a frame at a time so the var objects of a frame
+//          that has returned are skipped with one check. Changes are found
+//          once per root, its listed children are looked at only if it
+//          changed. The roots checked are marked as used, see
+//          CMICmnLLDBDebugSessionInfoVarObj::VarObjSetLimit().
+// Type:    Method.
+// Args:    eVarInfoFormat  - (R) Which values to print.
+//          vrFrame         - (R) The selected frame.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmdCmdVarUpdate::UpdateAll(
+    CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e eVarInfoFormat,
+    lldb::SBFrame &vrFrame) {
+  CMICmnLLDBDebugSessionInfoVarObj::VecVarObjHandle_t vecRoots;
+  CMICmnLLDBDebugSessionInfoVarObj::VarObjGetRoots(vecRoots);
+
+  // Thread, frame CFA, handle
+  typedef std::tuple<MIuint, lldb::addr_t,
+                     CMICmnLLDBDebugSessionInfoVarObj::VarObjHandle_t>
+      FrameKey_t;
+  std::vector<FrameKey_t> vecKeys;
+  vecKeys.reserve(vecRoots.size());
+  for (const CMICmnLLDBDebugSessionInfoVarObj::VarObjHandle_t nRoot :
+       vecRoots) {
+    const CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+        CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(nRoot);
+    if (pVarObj == nullptr)
+      continue;
+    // An expression result is evaluated again in the selected frame, as
+    // -var-update of its name does, whether or not its own frame has
+    // returned, so it is keyed like a value created outside a frame
+    if (pVarObj->GetValObjKind() == ValObjKind_ec::eValObjKind_ConstResult)
+      vecKeys.emplace_back(0, 0, nRoot);
+    else
+      vecKeys.emplace_back(pVarObj->GetFrameThreadId(),
+                           pVarObj->GetFrameCfa(), nRoot);
+  }
+  std::sort(vecKeys.begin(), vecKeys.end());
+
+  bool bFrameInScope = true;
+  bool bFrameChecked = false;
+  for (size_t i = 0; i < vecKeys.size(); ++i) {
+    const FrameKey_t &rKey = vecKeys[i];
+    if ((i > 0) && ((std::get<0>(rKey) != std::get<0>(vecKeys[i - 1])) ||
+                    (std::get<1>(rKey) != std::get<1>(vecKeys[i - 1]))))
+      bFrameChecked = false;
+    CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+        CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(std::get<2>(rKey));
+    if (pVarObj == nullptr)
+      continue;
+    // Values created outside a frame, and expression results, are always
+    // checked. The frame of the others is looked for once, the values of a frame that has returned are
+    // out of scope and cannot change.
+    if (!bFrameChecked) {
+      bFrameInScope = (std::get<1>(rKey) == 0) ||
+                      pVarObj->GetValue().GetFrame().IsValid();
+      bFrameChecked = true;
+    }
+    if (!bFrameInScope)
+      continue;
+
+    // A root still in scope is in use, keep it from being evicted before
+    // roots that are not
+    CMICmnLLDBDebugSessionInfoVarObj::VarObjTouch(*pVarObj);
+    if (!UpdateVarObj(eVarInfoFormat, *pVarObj, vrFrame, true))
+      return MIstatus::failure;
+  }
+
+  return MIstatus::success;
+}
+
 //++
 // Details: The invoker requires this function. The command does work in this
 // function.
 //          The command is likely to communicate with the LLDB SBDebugger in
 //          here.
+//          Synopsis: -var-update [print-values] {name | "*"}
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
@@ -441,54 +584,25 @@ bool CMICmdCmdVarUpdate::Execute() {
         static_cast<CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e>(
             pArgPrintValues->GetValue());
 
+  CMICmnLLDBDebugSessionInfo &rSessionInfo(
+      CMICmnLLDBDebugSessionInfo::Instance());
+  lldb::SBFrame frame =
+      rSessionInfo.GetProcess().GetSelectedThread().GetSelectedFrame();
+
   const CMIUtilString &rVarObjName(pArgName->GetValue());
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  if (rVarObjName == "*")
+    return UpdateAll(eVarInfoFormat, frame);
+
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+      CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName);
+  if (pVarObj == nullptr) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
     return MIstatus::failure;
   }
 
-  lldb::SBValue &rValue = varObj.GetValue();
-  const bool bVarChanged = varObj.ExchangeChanged(false);
-  if (!ExamineSBValueForChange(rValue, m_bValueChanged))
-    return MIstatus::failure;
-
-  // SBValue changed state due to a -var-assign may have already been
-  // cleared so combine it with changed state held by the var object
-  m_bValueChanged |= bVarChanged;
-
-  if (!m_bValueChanged) {
-    CMICmnLLDBDebugSessionInfo &rSessionInfo(
-        CMICmnLLDBDebugSessionInfo::Instance());
-
-    lldb::SBFrame frame =
-        rSessionInfo.GetProcess().GetSelectedThread().GetSelectedFrame();
-    if (!frame.IsValid()) {
-      SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_FRAME_INVALID),
-                                     m_constStrArgFrame.c_str()));
-      return MIstatus::failure;
-    }
-
-    const auto valObjKind = varObj.GetValObjKind();
-    if (valObjKind == ValObjKind_ec::eValObjKind_ConstResult) {
-      // This is likely an expression result and it should be re-evaluated.
-
-      auto tmpValue = frame.EvaluateExpression(varObj.GetNameReal().c_str());
-      if (tmpValue.IsValid() && tmpValue.GetError().Success()) {
-        m_bValueChanged = true;
-        rValue = std::move(tmpValue);
-      }
-    }
-  }
-
-  if (m_bValueChanged) {
-    varObj.UpdateValue();
-    return PrintValue(eVarInfoFormat, rValue, rVarObjName);
-  }
-
-  return MIstatus::success;
+  return UpdateVarObj(eVarInfoFormat, *pVarObj, frame, false);
 }
 
 //++
@@ -597,7 +711,9 @@ bool CMICmdCmdVarUpdate::ExamineSBValueForChange(lldb::SBValue &vrwValue,
 // Return:  None.
 // Throws:  None.
 //--
-CMICmdCmdVarDelete::CMICmdCmdVarDelete() : m_constStrArgName("name") {
+CMICmdCmdVarDelete::CMICmdCmdVarDelete()
+    : m_constStrArgChildrenOnly("c"), m_constStrArgName("name"),
+      m_nDeleted(0) {
   // Command factory matches this name with that received from the stdin stream
   m_strMiCmd = "var-delete";
 
@@ -606,18 +722,17 @@ CMICmdCmdVarDelete::CMICmdCmdVarDelete() : m_constStrArgName("name") {
 }
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarDelete::ParseArgs() {
+void CMICmdCmdVarDelete::DeclareArgs() {
+  m_setCmdArgs.Add(
+      new CMICmdArgValOptionShort(m_constStrArgChildrenOnly, false, false));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -641,10 +756,14 @@ CMICmdCmdVarDelete::~CMICmdCmdVarDelete() {}
 // Throws:  None.
 //--
 bool CMICmdCmdVarDelete::Execute() {
+  CMICMDBASE_GETOPTION(pArgChildrenOnly, OptionShort,
+                       m_constStrArgChildrenOnly);
   CMICMDBASE_GETOPTION(pArgName, String, m_constStrArgName);
 
+  // The children listed, and their children, are deleted too
   const CMIUtilString &rVarObjName(pArgName->GetValue());
-  CMICmnLLDBDebugSessionInfoVarObj::VarObjDelete(rVarObjName);
+  m_nDeleted = CMICmnLLDBDebugSessionInfoVarObj::VarObjDelete(
+      rVarObjName, pArgChildrenOnly->GetFound());
 
   return MIstatus::success;
 }
@@ -660,8 +779,13 @@ bool CMICmdCmdVarDelete::Execute() {
 // Throws:  None.
 //--
 bool CMICmdCmdVarDelete::Acknowledge() {
+  // MI print "%s^done,ndeleted=\"%u\""
+  const CMICmnMIValueConst miValueConst(
+      CMIUtilString::FormatTyped("%u", m_nDeleted));
+  const CMICmnMIValueResult miValueResult("ndeleted", miValueConst);
   const CMICmnMIResultRecord miRecordResult(
-      m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done);
+      m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
+      miValueResult);
   m_miResultRecord = miRecordResult;
 
   return MIstatus::success;
@@ -707,19 +831,16 @@ CMICmdCmdVarAssign::CMICmdCmdVarAssign()
 CMICmdCmdVarAssign::~CMICmdCmdVarAssign() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarAssign::ParseArgs() {
+void CMICmdCmdVarAssign::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
   m_setCmdArgs.Add(new CMICmdArgValText(m_constStrArgExpression, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -740,25 +861,27 @@ bool CMICmdCmdVarAssign::Execute() {
   const CMIUtilString &rVarObjName(pArgName->GetValue());
   const CMIUtilString &rExpression(pArgExpression->GetValue());
 
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+      CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName);
+  if (pVarObj == nullptr) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
     return MIstatus::failure;
   }
-  m_varObjName = rVarObjName;
 
   CMIUtilString strExpression(rExpression.Trim());
   strExpression = strExpression.Trim('"');
-  lldb::SBValue &rValue(varObj.GetValue());
+  lldb::SBValue &rValue(pVarObj->GetValue());
   CMIUtilString strOldValue(rValue.GetValue());
   m_bOk = rValue.SetValueFromCString(strExpression.c_str());
   if (m_bOk) {
+    CMICmnLLDBDebugSessionInfo::Instance().SnapshotInvalidate();
     CMIUtilString strNewValue(rValue.GetValue());
     const bool bVarChanged = !CMIUtilString::Compare(strOldValue, strNewValue);
-    varObj.ExchangeChanged(bVarChanged);
-    varObj.UpdateValue();
+    pVarObj->ExchangeChanged(bVarChanged);
+    pVarObj->UpdateValue();
+    m_strValue = pVarObj->GetValueFormatted();
   }
   return MIstatus::success;
 }
@@ -776,9 +899,7 @@ bool CMICmdCmdVarAssign::Execute() {
 bool CMICmdCmdVarAssign::Acknowledge() {
   if (m_bOk) {
     // MI print "%s^done,value=\"%s\""
-    CMICmnLLDBDebugSessionInfoVarObj varObj;
-    CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(m_varObjName, varObj);
-    const CMICmnMIValueConst miValueConst(varObj.GetValueFormatted());
+    const CMICmnMIValueConst miValueConst(m_strValue);
     const CMICmnMIValueResult miValueResult("value", miValueConst);
     const CMICmnMIResultRecord miRecordResult(
         m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
@@ -819,7 +940,8 @@ CMICmdBase *CMICmdCmdVarAssign::CreateSelf() {
 // Throws:  None.
 //--
 CMICmdCmdVarSetFormat::CMICmdCmdVarSetFormat()
-    : m_constStrArgName("name"), m_constStrArgFormatSpec("format-spec") {
+    : m_bInScope(false), m_constStrArgName("name"),
+      m_constStrArgFormatSpec("format-spec") {
   // Command factory matches this name with that received from the stdin stream
   m_strMiCmd = "var-set-format";
 
@@ -837,19 +959,16 @@ CMICmdCmdVarSetFormat::CMICmdCmdVarSetFormat()
 CMICmdCmdVarSetFormat::~CMICmdCmdVarSetFormat() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarSetFormat::ParseArgs() {
+void CMICmdCmdVarSetFormat::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgFormatSpec, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -870,14 +989,15 @@ bool CMICmdCmdVarSetFormat::Execute() {
   const CMIUtilString &rVarObjName(pArgName->GetValue());
   const CMIUtilString &rExpression(pArgFormatSpec->GetValue());
 
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+      CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName);
+  if (pVarObj == nullptr) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
     return MIstatus::failure;
   }
-  if (!varObj.SetVarFormat(
+  if (!pVarObj->SetVarFormat(
           CMICmnLLDBDebugSessionInfoVarObj::GetVarFormatForString(
               rExpression))) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_ENUM_INVALID),
@@ -885,9 +1005,11 @@ bool CMICmdCmdVarSetFormat::Execute() {
                                    rVarObjName.c_str(), rExpression.c_str()));
     return MIstatus::failure;
   }
-  varObj.UpdateValue();
+  pVarObj->UpdateValue();
 
   m_varObjName = rVarObjName;
+  m_strValue = pVarObj->GetValueFormatted();
+  m_bInScope = pVarObj->GetValue().IsInScope();
 
   return MIstatus::success;
 }
@@ -905,16 +1027,13 @@ bool CMICmdCmdVarSetFormat::Execute() {
 bool CMICmdCmdVarSetFormat::Acknowledge() {
   // MI print
   // "%s^done,changelist=[{name=\"%s\",value=\"%s\",in_scope=\"%s\",type_changed=\"false\",has_more=\"0\"}]"
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(m_varObjName, varObj);
   const CMICmnMIValueConst miValueConst(m_varObjName);
   const CMICmnMIValueResult miValueResult("name", miValueConst);
   CMICmnMIValueTuple miValueTuple(miValueResult);
-  const CMICmnMIValueConst miValueConst2(varObj.GetValueFormatted());
+  const CMICmnMIValueConst miValueConst2(m_strValue);
   const CMICmnMIValueResult miValueResult2("value", miValueConst2);
   miValueTuple.Add(miValueResult2);
-  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(varObj.GetValue());
-  const CMICmnMIValueConst miValueConst3(rValue.IsInScope() ? "true" : "false");
+  const CMICmnMIValueConst miValueConst3(m_bInScope ? "true" : "false");
   const CMICmnMIValueResult miValueResult3("in_scope", miValueConst3);
   miValueTuple.Add(miValueResult3);
   const CMICmnMIValueConst miValueConst4("false");
@@ -963,6 +1082,9 @@ CMICmdCmdVarListChildren::CMICmdCmdVarListChildren()
 
   // Required by the CMICmdFactory when registering *this command
   m_pSelfCreatorFn = &CMICmdCmdVarListChildren::CreateSelf;
+
+  // Finished commands are kept by the CMICmdFactory and reused
+  m_bReusable = true;
 }
 
 //++
@@ -975,22 +1097,37 @@ CMICmdCmdVarListChildren::CMICmdCmdVarListChildren()
 CMICmdCmdVarListChildren::~CMICmdCmdVarListChildren() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Return *this command to the state it was created in so it can be
+//          reused.
 // Type:    Overridden.
 // Args:    None.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmdCmdVarListChildren::ParseArgs() {
+bool CMICmdCmdVarListChildren::Reset() {
+  m_bValueValid = false;
+  m_nChildren = 0;
+  m_miValueList = CMICmnMIValueList(true);
+  m_bHasMore = false;
+
+  return CMICmdBase::Reset();
+}
+
+//++
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdCmdVarListChildren::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValPrintValues(m_constStrArgPrintValues, false, true));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgFrom, false, true));
   m_setCmdArgs.Add(new CMICmdArgValNumber(m_constStrArgTo, false, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1018,8 +1155,9 @@ bool CMICmdCmdVarListChildren::Execute() {
             pArgPrintValues->GetValue());
 
   const CMIUtilString &rVarObjName(pArgName->GetValue());
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+      CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName);
+  if (pVarObj == nullptr) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
@@ -1039,7 +1177,7 @@ bool CMICmdCmdVarListChildren::Execute() {
     return MIstatus::failure;
   }
 
-  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(varObj.GetValue());
+  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(pVarObj->GetValue());
   m_bValueValid = rValue.IsValid();
   if (!m_bValueValid)
     return MIstatus::success;
@@ -1055,12 +1193,11 @@ bool CMICmdCmdVarListChildren::Execute() {
     const CMIUtilString name(GetMemberName(rVarObjName, strExp, i));
     const MIuint nChildren = member.GetNumChildren();
     const CMIUtilString strThreadId(
-        CMIUtilString::Format("%u", member.GetThread().GetIndexID()));
+        CMIUtilString::FormatTyped("%u", member.GetThread().GetIndexID()));
 
-    // Varobj gets added to CMICmnLLDBDebugSessionInfoVarObj static container of
-    // varObjs
-    CMICmnLLDBDebugSessionInfoVarObj var(strExp, name, member, rVarObjName,
-                                         varObj.GetValObjKind());
+    CMICmnLLDBDebugSessionInfoVarObj::VarObjAdd(
+        CMICmnLLDBDebugSessionInfoVarObj(strExp, name, member, rVarObjName,
+                                         pVarObj->GetValObjKind()));
 
     // MI print
     // "child={name=\"%s\",exp=\"%s\",numchild=\"%d\",value=\"%s\",type=\"%s\",thread-id=\"%u\",has_more=\"%u\"}"
@@ -1070,7 +1207,8 @@ bool CMICmdCmdVarListChildren::Execute() {
     const CMICmnMIValueConst miValueConst2(strExp);
     const CMICmnMIValueResult miValueResult2("exp", miValueConst2);
     miValueTuple.Add(miValueResult2);
-    const CMIUtilString strNumChild(CMIUtilString::Format("%u", nChildren));
+    const CMIUtilString strNumChild(
+        CMIUtilString::FormatTyped("%u", nChildren));
     const CMICmnMIValueConst miValueConst3(strNumChild);
     const CMICmnMIValueResult miValueResult3("numchild", miValueConst3);
     miValueTuple.Add(miValueResult3);
@@ -1116,7 +1254,8 @@ bool CMICmdCmdVarListChildren::Execute() {
 bool CMICmdCmdVarListChildren::Acknowledge() {
   if (m_bValueValid) {
     // MI print "%s^done,numchild=\"%u\",children=[%s],has_more=\"%d\""
-    const CMIUtilString strNumChild(CMIUtilString::Format("%u", m_nChildren));
+    const CMIUtilString strNumChild(
+        CMIUtilString::FormatTyped("%u", m_nChildren));
     const CMICmnMIValueConst miValueConst(strNumChild);
     CMICmnMIValueResult miValueResult("numchild", miValueConst);
     if (m_nChildren != 0)
@@ -1184,21 +1323,18 @@ CMICmdCmdVarEvaluateExpression::CMICmdCmdVarEvaluateExpression()
 CMICmdCmdVarEvaluateExpression::~CMICmdCmdVarEvaluateExpression() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarEvaluateExpression::ParseArgs() {
+void CMICmdCmdVarEvaluateExpression::DeclareArgs() {
   m_setCmdArgs.Add(
       new CMICmdArgValOptionShort(m_constStrArgFormatSpec, false, false,
                                   CMICmdArgValListBase::eArgValType_String, 1));
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1216,21 +1352,22 @@ bool CMICmdCmdVarEvaluateExpression::Execute() {
   CMICMDBASE_GETOPTION(pArgName, String, m_constStrArgName);
 
   const CMIUtilString &rVarObjName(pArgName->GetValue());
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+      CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName);
+  if (pVarObj == nullptr) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
     return MIstatus::failure;
   }
 
-  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(varObj.GetValue());
+  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(pVarObj->GetValue());
   m_bValueValid = rValue.IsValid();
   if (!m_bValueValid)
     return MIstatus::success;
 
-  m_varObjName = rVarObjName;
-  varObj.UpdateValue();
+  pVarObj->UpdateValue();
+  m_strValue = pVarObj->GetValueFormatted();
 
   return MIstatus::success;
 }
@@ -1247,9 +1384,7 @@ bool CMICmdCmdVarEvaluateExpression::Execute() {
 //--
 bool CMICmdCmdVarEvaluateExpression::Acknowledge() {
   if (m_bValueValid) {
-    CMICmnLLDBDebugSessionInfoVarObj varObj;
-    CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(m_varObjName, varObj);
-    const CMICmnMIValueConst miValueConst(varObj.GetValueFormatted());
+    const CMICmnMIValueConst miValueConst(m_strValue);
     const CMICmnMIValueResult miValueResult("value", miValueConst);
     const CMICmnMIResultRecord miRecordResult(
         m_cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Done,
@@ -1306,18 +1441,15 @@ CMICmdCmdVarInfoPathExpression::CMICmdCmdVarInfoPathExpression()
 CMICmdCmdVarInfoPathExpression::~CMICmdCmdVarInfoPathExpression() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarInfoPathExpression::ParseArgs() {
+void CMICmdCmdVarInfoPathExpression::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1335,15 +1467,16 @@ bool CMICmdCmdVarInfoPathExpression::Execute() {
   CMICMDBASE_GETOPTION(pArgName, String, m_constStrArgName);
 
   const CMIUtilString &rVarObjName(pArgName->GetValue());
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj =
+      CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName);
+  if (pVarObj == nullptr) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
     return MIstatus::failure;
   }
 
-  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(varObj.GetValue());
+  lldb::SBValue &rValue = const_cast<lldb::SBValue &>(pVarObj->GetValue());
   m_bValueValid = rValue.IsValid();
   if (!m_bValueValid)
     return MIstatus::success;
@@ -1359,7 +1492,7 @@ bool CMICmdCmdVarInfoPathExpression::Execute() {
   const char *pPathExpression = stream.GetData();
   if (pPathExpression == nullptr) {
     // Build expression from what we do know
-    m_strPathExpression = varObj.GetNameReal();
+    m_strPathExpression = pVarObj->GetNameReal();
     return MIstatus::success;
   }
 
@@ -1370,21 +1503,25 @@ bool CMICmdCmdVarInfoPathExpression::Execute() {
   }
 
   // Build expression from what we do know
-  const CMIUtilString &rVarParentName(varObj.GetVarParentName());
+  const CMIUtilString &rVarParentName(pVarObj->GetVarParentName());
   if (rVarParentName.empty()) {
-    m_strPathExpression = varObj.GetNameReal();
+    m_strPathExpression = pVarObj->GetNameReal();
   } else {
-    CMICmnLLDBDebugSessionInfoVarObj varObjParent;
-    if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarParentName,
-                                                     varObjParent)) {
+    const CMICmnLLDBDebugSessionInfoVarObj *pVarObjParent =
+        CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(
+            pVarObj->GetParentHandle());
+    if (pVarObjParent == nullptr)
+      pVarObjParent =
+          CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarParentName);
+    if (pVarObjParent == nullptr) {
       SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                      m_cmdData.strMiCmd.c_str(),
                                      rVarParentName.c_str()));
       return MIstatus::failure;
     }
     m_strPathExpression =
-        CMIUtilString::Format("%s.%s", varObjParent.GetNameReal().c_str(),
-                              varObj.GetNameReal().c_str());
+        CMIUtilString::FormatTyped("%s.%s", pVarObjParent->GetNameReal(),
+                                   pVarObj->GetNameReal());
   }
 
   return MIstatus::success;
@@ -1460,18 +1597,15 @@ CMICmdCmdVarShowAttributes::CMICmdCmdVarShowAttributes()
 CMICmdCmdVarShowAttributes::~CMICmdCmdVarShowAttributes() {}
 
 //++
-// Details: The invoker requires this function. The parses the command line
-// options
-//          arguments to extract values for each of those arguments.
+// Details: Add the arguments *this command takes to the argument set, in the
+//          order they are parsed. Called once for the life of *this command.
 // Type:    Overridden.
 // Args:    None.
-// Return:  MIstatus::success - Functional succeeded.
-//          MIstatus::failure - Functional failed.
+// Return:  None.
 // Throws:  None.
 //--
-bool CMICmdCmdVarShowAttributes::ParseArgs() {
+void CMICmdCmdVarShowAttributes::DeclareArgs() {
   m_setCmdArgs.Add(new CMICmdArgValString(m_constStrArgName, true, true));
-  return ParseValidateCmdOptions();
 }
 
 //++
@@ -1489,8 +1623,7 @@ bool CMICmdCmdVarShowAttributes::Execute() {
   CMICMDBASE_GETOPTION(pArgName, String, m_constStrArgName);
 
   const CMIUtilString &rVarObjName(pArgName->GetValue());
-  CMICmnLLDBDebugSessionInfoVarObj varObj;
-  if (!CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(rVarObjName, varObj)) {
+  if (CMICmnLLDBDebugSessionInfoVarObj::VarObjFind(rVarObjName) == 0) {
     SetError(CMIUtilString::Format(MIRSRC(IDS_CMD_ERR_VARIABLE_DOESNOTEXIST),
                                    m_cmdData.strMiCmd.c_str(),
                                    rVarObjName.c_str()));
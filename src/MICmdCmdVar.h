@@ -60,7 +60,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
 
   // Overridden:
 public:
@@ -105,7 +106,9 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
+  bool Reset() override;
 
   // Overridden:
 public:
@@ -116,8 +119,15 @@ public:
 private:
   bool ExamineSBValueForChange(lldb::SBValue &vrwValue, bool &vrwbChanged);
   bool
+  UpdateVarObj(CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e eVarInfoFormat,
+               CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj,
+               lldb::SBFrame &vrFrame, const bool vbAll);
+  bool
+  UpdateAll(CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e eVarInfoFormat,
+            lldb::SBFrame &vrFrame);
+  bool
   PrintValue(CMICmnLLDBDebugSessionInfo::VariableInfoFormat_e eVarInfoFormat,
-             lldb::SBValue &value, const CMIUtilString &valueName);
+             CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj);
   void MIFormResponse(const CMIUtilString &vrStrVarName,
                       const char *const vpValue,
                       const CMIUtilString &vrStrScope);
@@ -150,13 +160,16 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarDelete() override;
 
   // Attribute:
 private:
+  const CMIUtilString m_constStrArgChildrenOnly;
   const CMIUtilString m_constStrArgName;
+  MIuint m_nDeleted; // Number of var objects deleted
 };
 
 //++
@@ -179,14 +192,15 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarAssign() override;
 
   // Attributes:
 private:
   bool m_bOk; // True = success, false = failure
-  CMIUtilString m_varObjName;
+  CMIUtilString m_strValue;
   const CMIUtilString m_constStrArgName;
   const CMIUtilString m_constStrArgExpression;
 };
@@ -211,13 +225,16 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarSetFormat() override;
 
   // Attributes:
 private:
   CMIUtilString m_varObjName;
+  CMIUtilString m_strValue;
+  bool m_bInScope; // True = the value is in scope, false = not
   const CMIUtilString m_constStrArgName;
   const CMIUtilString m_constStrArgFormatSpec;
 };
@@ -242,7 +259,9 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
+  bool Reset() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarListChildren() override;
 
@@ -278,14 +297,15 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarEvaluateExpression() override;
 
   // Attributes:
 private:
   bool m_bValueValid; // True = yes SBValue object is valid, false = not valid
-  CMIUtilString m_varObjName;
+  CMIUtilString m_strValue;
   const CMIUtilString m_constStrArgFormatSpec; // Not handled by *this command
   const CMIUtilString m_constStrArgName;
 };
@@ -310,7 +330,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarInfoPathExpression() override;
 
@@ -341,7 +362,8 @@ public:
   // From CMICmdInvoker::ICmd
   bool Execute() override;
   bool Acknowledge() override;
-  bool ParseArgs() override;
+  // From CMICmdBase
+  void DeclareArgs() override;
   // From CMICmnBase
   /* dtor */ ~CMICmdCmdVarShowAttributes() override;
 
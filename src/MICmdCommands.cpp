@@ -12,8 +12,9 @@
 //              command base
 //              class. To enable the new command for interpretation add the new
 //              command class
-//              to the command factory. The files of relevance are:
-//                  MICmdCommands.cpp
+//              to the command table in MICmdCommands.def. The files of
+//              relevance are:
+//                  MICmdCommands.def
 //                  MICmdBase.h / .cpp
 //                  MICmdCmd.h / .cpp
 
@@ -39,99 +40,69 @@
 #include "MICmdCmdTrace.h"
 #include "MICmdCmdVar.h"
 #include "MICmdFactory.h"
+#include "MICmnResources.h"
+#include "MIUtilPerfectHash.h"
 
-namespace MICmnCommands {
-template <typename T> static bool Register();
-}
+namespace {
+//++
+// Details: A MI command the factory can create.
+//--
+struct SCmdEntry {
+  const char *pName;                         // The MI command name
+  CMICmdFactory::CmdCreatorFnPtr pCreatorFn; // The command's CreateSelf()
+};
+
+// The MI commands, listed in MICmdCommands.def
+constexpr SCmdEntry gCmdTable[] = {
+#define MI_CMD(name, cmdClass) {name, &cmdClass::CreateSelf},
+#include "MICmdCommands.def"
+};
+
+constexpr CMIUtilPerfectHash<sizeof(gCmdTable) / sizeof(gCmdTable[0])>
+    gCmdHash(gCmdTable);
+static_assert(gCmdHash.IsValid(),
+              "MI command registered twice or no perfect hash seed found");
+} // namespace
 
 //++
-// Details: Command to command factory registration function.
-// Type:    Template function.
-// Args:    typename T  - A command type class.
-// Return:  bool  - True = yes command is registered, false = command failed to
-// register.
+// Details: Look up a MI command's creator function in the command table.
+// Type:    Function.
+// Args:    vMiCmd  - (R) Command's name, the MI command.
+// Return:  CMICmdFactory::CmdCreatorFnPtr - Creator function, nullptr = not
+//          found.
 // Throws:  None.
 //--
-template <typename T> static bool MICmnCommands::Register() {
-  static CMICmdFactory &rCmdFactory = CMICmdFactory::Instance();
-  const CMIUtilString strMiCmd = T().GetMiCmd();
-  CMICmdFactory::CmdCreatorFnPtr fn = T().GetCmdCreatorFn();
-  return rCmdFactory.CmdRegister(strMiCmd, fn);
+CMICmdFactory::CmdCreatorFnPtr
+MICmnCommands::Find(const CMIUtilString &vMiCmd) {
+  const int nIndex = gCmdHash.Find(vMiCmd.c_str(), vMiCmd.size());
+  return (nIndex >= 0) ? gCmdTable[nIndex].pCreatorFn : nullptr;
 }
 
 //++
-// Details: Register commands with MI command factory
+// Details: Check each command in the command table can be created and has
+//          the name it is listed under.
 // Type:    Function.
-// Args:    None.
-// Return:  bool  - True = yes all commands are registered,
-//                  false = one or more commands failed to register.
+// Args:    vwErrMsg    - (W) Why a command is not valid.
+// Return:  bool  - True = yes all commands are valid,
+//                  false = one or more commands are not.
 // Throws:  None.
 //--
-bool MICmnCommands::RegisterAll() {
-  bool bOk = MIstatus::success;
-
-  bOk &= Register<CMICmdCmdSupportInfoMiCmdQuery>();
-  bOk &= Register<CMICmdCmdBreakAfter>();
-  bOk &= Register<CMICmdCmdBreakCondition>();
-  bOk &= Register<CMICmdCmdBreakDelete>();
-  bOk &= Register<CMICmdCmdBreakDisable>();
-  bOk &= Register<CMICmdCmdBreakEnable>();
-  bOk &= Register<CMICmdCmdBreakInsert>();
-  bOk &= Register<CMICmdCmdBreakWatch>();
-  bOk &= Register<CMICmdCmdDataDisassemble>();
-  bOk &= Register<CMICmdCmdDataEvaluateExpression>();
-  bOk &= Register<CMICmdCmdDataInfoLine>();
-  bOk &= Register<CMICmdCmdDataReadMemoryBytes>();
-  bOk &= Register<CMICmdCmdDataReadMemory>();
-  bOk &= Register<CMICmdCmdDataListRegisterNames>();
-  bOk &= Register<CMICmdCmdDataListRegisterValues>();
-  bOk &= Register<CMICmdCmdDataWriteMemoryBytes>();
-  bOk &= Register<CMICmdCmdDataWriteMemory>();
-  bOk &= Register<CMICmdCmdEnablePrettyPrinting>();
-  bOk &= Register<CMICmdCmdEnvironmentCd>();
-  bOk &= Register<CMICmdCmdExecAbort>();
-  bOk &= Register<CMICmdCmdExecArguments>();
-  bOk &= Register<CMICmdCmdExecContinue>();
-  bOk &= Register<CMICmdCmdExecInterrupt>();
-  bOk &= Register<CMICmdCmdExecFinish>();
-  bOk &= Register<CMICmdCmdExecNext>();
-  bOk &= Register<CMICmdCmdExecNextInstruction>();
-  bOk &= Register<CMICmdCmdExecRun>();
-  bOk &= Register<CMICmdCmdExecStep>();
-  bOk &= Register<CMICmdCmdExecStepInstruction>();
-  bOk &= Register<CMICmdCmdFileExecAndSymbols>();
-  bOk &= Register<CMICmdCmdGdbExit>();
-  bOk &= Register<CMICmdCmdGdbInfo>();
-  bOk &= Register<CMICmdCmdGdbSet>();
-  bOk &= Register<CMICmdCmdGdbShow>();
-  bOk &= Register<CMICmdCmdGdbThread>();
-  bOk &= Register<CMICmdCmdInferiorTtySet>();
-  bOk &= Register<CMICmdCmdInterpreterExec>();
-  bOk &= Register<CMICmdCmdListThreadGroups>();
-  bOk &= Register<CMICmdCmdSource>();
-  bOk &= Register<CMICmdCmdStackInfoDepth>();
-  bOk &= Register<CMICmdCmdStackInfoFrame>();
-  bOk &= Register<CMICmdCmdStackListFrames>();
-  bOk &= Register<CMICmdCmdStackListArguments>();
-  bOk &= Register<CMICmdCmdStackListLocals>();
-  bOk &= Register<CMICmdCmdStackListVariables>();
-  bOk &= Register<CMICmdCmdStackSelectFrame>();
-  bOk &= Register<CMICmdCmdSupportListFeatures>();
-  bOk &= Register<CMICmdCmdSymbolListLines>();
-  bOk &= Register<CMICmdCmdTargetSelect>();
-  bOk &= Register<CMICmdCmdTargetAttach>();
-  bOk &= Register<CMICmdCmdTargetDetach>();
-  bOk &= Register<CMICmdCmdThreadInfo>();
-  bOk &= Register<CMICmdCmdThreadSelect>();
-  bOk &= Register<CMICmdCmdVarAssign>();
-  bOk &= Register<CMICmdCmdVarCreate>();
-  bOk &= Register<CMICmdCmdVarDelete>();
-  bOk &= Register<CMICmdCmdVarEvaluateExpression>();
-  bOk &= Register<CMICmdCmdVarInfoPathExpression>();
-  bOk &= Register<CMICmdCmdVarListChildren>();
-  bOk &= Register<CMICmdCmdVarSetFormat>();
-  bOk &= Register<CMICmdCmdVarShowAttributes>();
-  bOk &= Register<CMICmdCmdVarUpdate>();
+bool MICmnCommands::CheckAll(CMIUtilString &vwErrMsg) {
+  for (const SCmdEntry &rEntry : gCmdTable) {
+    CMICmdBase *pCmd = (*rEntry.pCreatorFn)();
+    if (pCmd == nullptr) {
+      vwErrMsg = CMIUtilString::Format(
+          MIRSRC(IDS_CMDFACTORY_ERR_INVALID_CMD_CR8FN), rEntry.pName);
+      return MIstatus::failure;
+    }
+    const bool bNameOk = (pCmd->GetMiCmd() == rEntry.pName);
+    delete pCmd;
+    if (!bNameOk) {
+      vwErrMsg = CMIUtilString::Format(
+          MIRSRC(IDS_CMDFACTORY_ERR_INVALID_CMD_NAME), rEntry.pName);
+      return MIstatus::failure;
+    }
+  }
 
-  return bOk;
+  return MIstatus::success;
 }
@@ -8,12 +8,16 @@
 
 #pragma once
 
+// In-house headers:
+#include "MICmdFactory.h"
+
 namespace MICmnCommands {
 
 //++
 //============================================================================
-// Details: MI Command are instantiated and registered automatically with the
-//          Command Factory
+// Details: MI Commands are listed in a table the compiler builds a perfect
+//          hash of. The Command Factory looks commands up in it.
 //--
-bool RegisterAll();
+CMICmdFactory::CmdCreatorFnPtr Find(const CMIUtilString &vMiCmd);
+bool CheckAll(CMIUtilString &vwErrMsg);
 } // namespace MICmnCommands
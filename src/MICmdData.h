@@ -11,6 +11,9 @@
 // In-house headers:
 #include "MICmnResources.h"
 
+// Declarations:
+class CMICmdBase;
+
 //++
 //============================================================================
 // Details: MI command metadata. Holds the command's name, MI number and options
@@ -20,7 +23,8 @@
 struct SMICmdData {
   SMICmdData()
       : id(0), bCmdValid(false), bCmdExecutedSuccessfully(false),
-        bMIOldStyle(false), bHasResultRecordExtra(false) {}
+        bMIOldStyle(false), bHasResultRecordExtra(false),
+        pCmdCreatorFn(nullptr) {}
 
   MIuint id;                    // A command's unique ID i.e. GUID
   CMIUtilString strMiCmdToken;  // The command's MI token (a number)
@@ -40,6 +44,9 @@ struct SMICmdData {
   bool bHasResultRecordExtra; // True = Yes command produced additional MI
                               // output to its 1 line response, false = no extra
                               // MI output formed
+  CMICmdBase *(*pCmdCreatorFn)(); // The command's creator function the
+                                  // interpreter found in the command factory,
+                                  // nullptr = not looked up or not found
 
   void Clear() {
     id = 0;
@@ -54,5 +61,6 @@ struct SMICmdData {
     strErrorDescription.clear();
     bMIOldStyle = false;
     bHasResultRecordExtra = false;
+    pCmdCreatorFn = nullptr;
   }
 };
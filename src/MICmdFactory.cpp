@@ -8,11 +8,15 @@
 
 // In-house headers:
 #include "MICmdFactory.h"
+#include "MICmdArgSet.h"
 #include "MICmdBase.h"
 #include "MICmdCommands.h"
 #include "MICmdData.h"
 #include "MICmnResources.h"
 
+// Instantiations:
+const size_t CMICmdFactory::ms_nPoolMax = 4;
+
 //++
 // Details: CMICmdFactory constructor.
 // Type:    Method.
@@ -45,9 +49,13 @@ bool CMICmdFactory::Initialize() {
   if (m_bInitialized)
     return MIstatus::success;
 
-  m_bInitialized = true;
+  CMIUtilString errMsg;
+  if (!MICmnCommands::CheckAll(errMsg)) {
+    SetErrorDescription(errMsg);
+    return MIstatus::failure;
+  }
 
-  MICmnCommands::RegisterAll();
+  m_bInitialized = true;
 
   return MIstatus::success;
 }
@@ -67,63 +75,14 @@ bool CMICmdFactory::Shutdown() {
   if (!m_bInitialized)
     return MIstatus::success;
 
-  m_mapMiCmdToCmdCreatorFn.clear();
-
   m_bInitialized = false;
 
-  return MIstatus::success;
-}
-
-//++
-// Details: Register a command's creator function with the command identifier
-// the MI
-//          command name i.e. 'file-exec-and-symbols'.
-// Type:    Method.
-// Args:    vMiCmd          - (R) Command's name, the MI command.
-//          vCmdCreateFn    - (R) Command's creator function pointer.
-// Return:  MIstatus::success - Functionality succeeded.
-//          MIstatus::failure - Functionality failed.
-// Throws:  None.
-//--
-bool CMICmdFactory::CmdRegister(const CMIUtilString &vMiCmd,
-                                CmdCreatorFnPtr vCmdCreateFn) {
-  if (!IsValid(vMiCmd)) {
-    SetErrorDescription(CMIUtilString::Format(
-        MIRSRC(IDS_CMDFACTORY_ERR_INVALID_CMD_NAME), vMiCmd.c_str()));
-    return MIstatus::failure;
-  }
-  if (vCmdCreateFn == nullptr) {
-    SetErrorDescription(CMIUtilString::Format(
-        MIRSRC(IDS_CMDFACTORY_ERR_INVALID_CMD_CR8FN), vMiCmd.c_str()));
-    return MIstatus::failure;
-  }
-
-  if (HaveAlready(vMiCmd)) {
-    SetErrorDescription(CMIUtilString::Format(
-        MIRSRC(IDS_CMDFACTORY_ERR_CMD_ALREADY_REGED), vMiCmd.c_str()));
-    return MIstatus::failure;
-  }
-
-  MapPairMiCmdToCmdCreatorFn_t pr(vMiCmd, vCmdCreateFn);
-  m_mapMiCmdToCmdCreatorFn.insert(pr);
+  PoolDeleteAll();
+  ArgSetDeleteAll();
 
   return MIstatus::success;
 }
 
-//++
-// Details: Check a command is already registered.
-// Type:    Method.
-// Args:    vMiCmd  - (R) Command's name, the MI command.
-// Return:  True - registered.
-//          False - not found.
-// Throws:  None.
-//--
-bool CMICmdFactory::HaveAlready(const CMIUtilString &vMiCmd) const {
-  const MapMiCmdToCmdCreatorFn_t::const_iterator it =
-      m_mapMiCmdToCmdCreatorFn.find(vMiCmd);
-  return it != m_mapMiCmdToCmdCreatorFn.end();
-}
-
 //++
 // Details: Check a command's name is valid:
 //              - name is not empty
@@ -150,7 +109,7 @@ bool CMICmdFactory::IsValid(const CMIUtilString &vMiCmd) const {
 }
 
 //++
-// Details: Check a command is already registered.
+// Details: Check a command is in the command table.
 // Type:    Method.
 // Args:    vMiCmd  - (R) Command's name, the MI command.
 // Return:  True - registered.
@@ -158,13 +117,28 @@ bool CMICmdFactory::IsValid(const CMIUtilString &vMiCmd) const {
 // Throws:  None.
 //--
 bool CMICmdFactory::CmdExist(const CMIUtilString &vMiCmd) const {
-  return HaveAlready(vMiCmd);
+  return CmdFind(vMiCmd) != nullptr;
+}
+
+//++
+// Details: Look up a command's creator function in the command table. The
+//          look up is a single probe of a perfect hash of the command names.
+// Type:    Method.
+// Args:    vMiCmd  - (R) Command's name, the MI command.
+// Return:  CmdCreatorFnPtr - Creator function, nullptr = not found.
+// Throws:  None.
+//--
+CMICmdFactory::CmdCreatorFnPtr
+CMICmdFactory::CmdFind(const CMIUtilString &vMiCmd) const {
+  return MICmnCommands::Find(vMiCmd);
 }
 
 //++
 // Details: Create a command given the specified MI command name. The command
 // data object
-//          contains the options for the command.
+//          contains the options for the command. The creator function the
+//          interpreter resolved into the command data is used when present so
+//          the command is not looked up again.
 // Type:    Method.
 // Args:    vMiCmd      - (R) Command's name, the MI command.
 //          vCmdData    - (RW) Command's metadata status/information/result
@@ -179,23 +153,32 @@ bool CMICmdFactory::CmdCreate(const CMIUtilString &vMiCmd,
                               CMICmdBase *&vpNewCmd) {
   vpNewCmd = nullptr;
 
-  if (!IsValid(vMiCmd)) {
-    SetErrorDescription(CMIUtilString::Format(
-        MIRSRC(IDS_CMDFACTORY_ERR_INVALID_CMD_NAME), vMiCmd.c_str()));
-    return MIstatus::failure;
+  CmdCreatorFnPtr pFn = vCmdData.pCmdCreatorFn;
+  if ((pFn == nullptr) || (vMiCmd != vCmdData.strMiCmd)) {
+    if (!IsValid(vMiCmd)) {
+      SetErrorDescription(CMIUtilString::Format(
+          MIRSRC(IDS_CMDFACTORY_ERR_INVALID_CMD_NAME), vMiCmd.c_str()));
+      return MIstatus::failure;
+    }
+    pFn = CmdFind(vMiCmd);
   }
-  if (!HaveAlready(vMiCmd)) {
+  if (pFn == nullptr) {
     SetErrorDescription(CMIUtilString::Format(
         MIRSRC(IDS_CMDFACTORY_ERR_CMD_NOT_REGISTERED), vMiCmd.c_str()));
     return MIstatus::failure;
   }
 
-  const MapMiCmdToCmdCreatorFn_t::const_iterator it =
-      m_mapMiCmdToCmdCreatorFn.find(vMiCmd);
-  const CMIUtilString &rMiCmd((*it).first);
-  MIunused(rMiCmd);
-  CmdCreatorFnPtr pFn = (*it).second;
-  CMICmdBase *pCmd = (*pFn)();
+  CMICmdBase *pCmd = nullptr;
+  MapCreatorFnToPool_t::iterator it = m_mapCreatorFnToPool.find(pFn);
+  if ((it != m_mapCreatorFnToPool.end()) && !it->second.empty()) {
+    pCmd = it->second.back();
+    it->second.pop_back();
+  } else {
+    pCmd = (*pFn)();
+    MapCreatorFnToArgSet_t::iterator itArgSet = m_mapCreatorFnToArgSet.find(pFn);
+    if (itArgSet != m_mapCreatorFnToArgSet.end())
+      pCmd->ArgSetAdopt(*itArgSet->second);
+  }
 
   SMICmdData cmdData(vCmdData);
   cmdData.id = pCmd->GetGUID();
@@ -204,3 +187,61 @@ bool CMICmdFactory::CmdCreate(const CMIUtilString &vMiCmd,
 
   return MIstatus::success;
 }
+
+//++
+// Details: Take back a command that has finished its work. A command that can
+//          be reused is reset and kept for the next command of its type
+//          unless enough of that type are kept already. Other commands are
+//          deleted, keeping their arguments if none of their type are kept.
+// Type:    Method.
+// Args:    vpCmd   - (R) Command object, the factory owns it from now on.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdFactory::CmdRelease(CMICmdBase *vpCmd) {
+  if (vpCmd == nullptr)
+    return;
+
+  if (m_bInitialized) {
+    VecCmds_t &rPool = m_mapCreatorFnToPool[vpCmd->GetCmdCreatorFn()];
+    if ((rPool.size() < ms_nPoolMax) && vpCmd->Reset()) {
+      rPool.push_back(vpCmd);
+      return;
+    }
+
+    // Keep the arguments it declared for the next command of its type
+    CMICmdArgSet *&rpArgSet = m_mapCreatorFnToArgSet[vpCmd->GetCmdCreatorFn()];
+    if (rpArgSet == nullptr)
+      rpArgSet = new CMICmdArgSet;
+    vpCmd->ArgSetRelease(*rpArgSet);
+  }
+
+  delete vpCmd;
+}
+
+//++
+// Details: Delete the arguments kept for each command type.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdFactory::ArgSetDeleteAll() {
+  for (auto &rFnArgSet : m_mapCreatorFnToArgSet)
+    delete rFnArgSet.second;
+  m_mapCreatorFnToArgSet.clear();
+}
+
+//++
+// Details: Delete the commands kept for reuse.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdFactory::PoolDeleteAll() {
+  for (auto &rFnPool : m_mapCreatorFnToPool)
+    for (CMICmdBase *pCmd : rFnPool.second)
+      delete pCmd;
+  m_mapCreatorFnToPool.clear();
+}
@@ -8,21 +8,29 @@
 
 #pragma once
 
-// Third party headers
+// Third party headers:
 #include <map>
+#include <vector>
 
 // In-house headers:
 #include "MICmnBase.h"
 #include "MIUtilSingletonBase.h"
 
 // Declarations:
+class CMICmdArgSet;
 class CMICmdBase;
 struct SMICmdData;
 
 //++
 //============================================================================
-// Details: MI Command Factory. Holds a list of registered MI commands that
-//          MI application understands to interpret. Creates commands objects.
+// Details: MI Command Factory. Looks up the MI commands the MI application
+//          understands to interpret in the command table (see
+//          MICmdCommands.cpp). Creates commands objects.
+//          Commands that can be reused are given back to the factory when
+//          they finish. The factory keeps a few of each type and hands them
+//          out again rather than creating new ones. Of the other commands
+//          the factory keeps the arguments they declared, one set for each
+//          type, and gives them to the next command of that type it creates.
 //          The Command Factory is carried out in the main thread.
 //          A singleton class.
 //--
@@ -53,10 +61,11 @@ public:
 public:
   bool Initialize() override;
   bool Shutdown() override;
-  bool CmdRegister(const CMIUtilString &vMiCmd, CmdCreatorFnPtr vCmdCreateFn);
   bool CmdCreate(const CMIUtilString &vMiCmd, const SMICmdData &vCmdData,
                  CMICmdBase *&vpNewCmd);
   bool CmdExist(const CMIUtilString &vMiCmd) const;
+  CmdCreatorFnPtr CmdFind(const CMIUtilString &vMiCmd) const;
+  void CmdRelease(CMICmdBase *vpCmd);
 
   // Methods:
 private:
@@ -64,21 +73,27 @@ private:
   /* ctor */ CMICmdFactory(const CMICmdFactory &);
   void operator=(const CMICmdFactory &);
 
-  bool HaveAlready(const CMIUtilString &vMiCmd) const;
   bool IsValid(const CMIUtilString &vMiCmd) const;
+  void PoolDeleteAll();
+  void ArgSetDeleteAll();
+
+  // Typedefs:
+private:
+  typedef std::vector<CMICmdBase *> VecCmds_t;
+  typedef std::map<CmdCreatorFnPtr, VecCmds_t> MapCreatorFnToPool_t;
+  typedef std::map<CmdCreatorFnPtr, CMICmdArgSet *> MapCreatorFnToArgSet_t;
 
   // Overridden:
 private:
   // From CMICmnBase
   /* dtor */ ~CMICmdFactory() override;
 
-  // Typedefs:
-private:
-  typedef std::map<CMIUtilString, CmdCreatorFnPtr> MapMiCmdToCmdCreatorFn_t;
-  typedef std::pair<CMIUtilString, CmdCreatorFnPtr>
-      MapPairMiCmdToCmdCreatorFn_t;
-
   // Attributes:
 private:
-  MapMiCmdToCmdCreatorFn_t m_mapMiCmdToCmdCreatorFn;
+  MapCreatorFnToPool_t m_mapCreatorFnToPool; // Finished commands ready to be
+                                             // reused, by command type
+  MapCreatorFnToArgSet_t m_mapCreatorFnToArgSet; // Arguments declared by a
+                                                 // command type, empty while
+                                                 // a command holds them
+  static const size_t ms_nPoolMax; // Most commands kept of one type
 };
@@ -91,6 +91,8 @@ bool CMICmdInterpreter::ValidateIsMi(const CMIUtilString &vTextLine,
   if (vTextLine.empty())
     return MIstatus::success;
 
+  CMIUtilThreadLock lock(m_mutex);
+
   // MI format is [cmd #]-[command name]<space>[command arg(s)]
   // i.e. 1-file-exec-and-symbols --thread-group i1 DEVICE_EXECUTABLE
   //      5-data-evaluate-expression --thread 1 --frame 0 *(argv)
@@ -103,7 +105,7 @@ bool CMICmdInterpreter::ValidateIsMi(const CMIUtilString &vTextLine,
                  MiHasCmdTokenEndingAlpha(vTextLine));
   vwbYesValid = vwbYesValid && MiHasCmd(vTextLine);
   if (vwbYesValid) {
-    vwbCmdNotInCmdFactor = !HasCmdFactoryGotMiCmd(MiGetCmdData());
+    vwbCmdNotInCmdFactor = !HasCmdFactoryGotMiCmd(m_miCmdData);
     vwbYesValid = !vwbCmdNotInCmdFactor;
   }
 
@@ -119,15 +121,17 @@ bool CMICmdInterpreter::ValidateIsMi(const CMIUtilString &vTextLine,
 //++
 // Details: Establish whether the command name entered on the stdin stream is
 // recognised by
-//          the MI driver.
+//          the MI driver. The command's creator function is kept in the
+//          command information so the factory need not look it up again.
 // Type:    Method.
-// Args:    vCmd    - (R) Command information structure.
+// Args:    vwCmd   - (RW) Command information structure.
 // Return:  bool  - True = yes command is recognised, false = command not
 // recognised.
 // Throws:  None.
 //--
-bool CMICmdInterpreter::HasCmdFactoryGotMiCmd(const SMICmdData &vCmd) const {
-  return m_rCmdFactory.CmdExist(vCmd.strMiCmd);
+bool CMICmdInterpreter::HasCmdFactoryGotMiCmd(SMICmdData &vwCmd) const {
+  vwCmd.pCmdCreatorFn = m_rCmdFactory.CmdFind(vwCmd.strMiCmd);
+  return vwCmd.pCmdCreatorFn != nullptr;
 }
 
 //++
@@ -12,6 +12,7 @@
 #include "MICmdData.h"
 #include "MICmnBase.h"
 #include "MIUtilSingletonBase.h"
+#include "MIUtilThreadBaseStd.h"
 
 // Declarations:
 class CMICmdFactory;
@@ -43,7 +44,7 @@ private:
   /* ctor */ CMICmdInterpreter(const CMICmdInterpreter &);
   void operator=(const CMICmdInterpreter &);
 
-  bool HasCmdFactoryGotMiCmd(const SMICmdData &vCmdData) const;
+  bool HasCmdFactoryGotMiCmd(SMICmdData &vwCmdData) const;
   bool MiHasCmdTokenEndingHyphen(const CMIUtilString &vTextLine);
   bool MiHasCmdTokenEndingAlpha(const CMIUtilString &vTextLine);
   bool MiHasCmd(const CMIUtilString &vTextLine);
@@ -58,5 +59,7 @@ private:
   // Attributes:
 private:
   SMICmdData m_miCmdData; // Filled in on each new line being interpreted
+  CMIUtilThreadMutex m_mutex; // Lines are interpreted by the command reader
+                              // thread as well as the main thread
   CMICmdFactory &m_rCmdFactory;
 };
@@ -11,6 +11,7 @@
 #include "MICmdBase.h"
 #include "MICmdMgr.h"
 #include "MICmnLog.h"
+#include "MICmnMIValueArena.h"
 #include "MICmnStreamStdout.h"
 #include "MIDriver.h"
 
@@ -96,6 +97,11 @@ void CMICmdInvoker::CmdDeleteAll() {
     ++it;
   }
   m_mapCmdIdToCmd.clear();
+
+  for (auto &rIdArena : m_mapCmdIdToArena)
+    delete rIdArena.second;
+  m_mapCmdIdToArena.clear();
+  m_mapCmdIdToSample.clear();
 }
 
 //++
@@ -119,7 +125,15 @@ bool CMICmdInvoker::CmdDelete(const MIuint vId,
       // Via registered interest command manager callback *this object to delete
       // the command
       m_mapCmdIdToCmd.erase(it);
-      delete pCmd;
+      CMICmdFactory::Instance().CmdRelease(pCmd);
+
+      // The command's values are gone, free the buffers they leave
+      MapCmdIdToArena_t::iterator itArena = m_mapCmdIdToArena.find(vId);
+      if (itArena != m_mapCmdIdToArena.end()) {
+        delete itArena->second;
+        m_mapCmdIdToArena.erase(itArena);
+      }
+      m_mapCmdIdToSample.erase(vId);
     } else
       // Notify other interested object of this command's pending deletion
       rMgr.CmdDelete(pCmd->GetCmdData());
@@ -153,10 +167,52 @@ bool CMICmdInvoker::CmdAdd(const CMICmdBase &vCmd) {
 
   MapPairCmdIdToCmd_t pr(cmdId, const_cast<CMICmdBase *>(&vCmd));
   m_mapCmdIdToCmd.insert(pr);
+  m_mapCmdIdToArena[cmdId] = new CMICmnMIValueArena;
+  m_mapCmdIdToSample[cmdId] = CMICmdStats::SSample();
 
   return MIstatus::success;
 }
 
+//++
+// Details: Retrieve the value arena of a command doing work.
+// Type:    Method.
+// Args:    vCmdId  - (R) Command object's unique ID.
+// Return:  CMICmnMIValueArena * - The arena, nullptr = command not found.
+// Throws:  None.
+//--
+CMICmnMIValueArena *CMICmdInvoker::CmdGetArena(const MIuint vCmdId) const {
+  MapCmdIdToArena_t::const_iterator it = m_mapCmdIdToArena.find(vCmdId);
+  return (it != m_mapCmdIdToArena.end()) ? it->second : nullptr;
+}
+
+//++
+// Details: Keep the times a command doing work took to parse its arguments
+//          and to execute.
+// Type:    Method.
+// Args:    vCmdId      - (R) Command object's unique ID.
+//          vtmStart    - (R) When argument parsing started.
+//          vtmParsed   - (R) When argument parsing finished.
+//          vtmExecuted - (R) When Execute() returned.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdInvoker::CmdSetPhaseTimes(
+    const MIuint vCmdId, const CMICmdStats::TimePoint_t &vtmStart,
+    const CMICmdStats::TimePoint_t &vtmParsed,
+    const CMICmdStats::TimePoint_t &vtmExecuted) {
+  // Execute() may have got the command deleted
+  MapCmdIdToSample_t::iterator it = m_mapCmdIdToSample.find(vCmdId);
+  if (it == m_mapCmdIdToSample.end())
+    return;
+
+  CMICmdStats::SSample &rSample = it->second;
+  rSample.tmStart = vtmStart;
+  rSample.anPhaseNs[CMICmdStats::ePhase_Args] =
+      CMICmdStats::ElapsedNs(vtmStart, vtmParsed);
+  rSample.anPhaseNs[CMICmdStats::ePhase_Execute] =
+      CMICmdStats::ElapsedNs(vtmParsed, vtmExecuted);
+}
+
 //++
 // Details: Having previously had the potential command validated and found
 // valid now
@@ -173,24 +229,25 @@ bool CMICmdInvoker::CmdAdd(const CMICmdBase &vCmd) {
 bool CMICmdInvoker::CmdExecute(CMICmdBase &vCmd) {
   bool bOk = CmdAdd(vCmd);
 
+  bool bExecuted = false;
   if (bOk) {
-    vCmd.AddCommonArgs();
-    if (!vCmd.ParseArgs()) {
-      // Report command execution failed
-      const SMICmdData cmdData(vCmd.GetCmdData());
-      CmdStdout(cmdData);
-      CmdCauseAppExit(vCmd);
-      CmdDelete(cmdData.id);
-
-      // Proceed to wait or execute next command
-      return MIstatus::success;
-    }
+    // The values the command forms draw on its arena. The arena must not be
+    // current once the command is deleted.
+    const CMICmnMIValueArena::CScope arenaScope(
+        CmdGetArena(vCmd.GetCmdData().id));
+    const CMICmdStats::TimePoint_t tmStart = CMICmdStats::Now();
+    vCmd.AddArgs();
+    const bool bParsed = vCmd.ParseArgs();
+    const CMICmdStats::TimePoint_t tmParsed = CMICmdStats::Now();
+    bExecuted = bParsed && vCmd.Execute();
+    CmdSetPhaseTimes(vCmd.GetCmdData().id, tmStart, tmParsed,
+                     CMICmdStats::Now());
   }
 
-  if (bOk && !vCmd.Execute()) {
+  if (bOk && !bExecuted) {
     // Report command execution failed
     const SMICmdData cmdData(vCmd.GetCmdData());
-    CmdStdout(cmdData);
+    CmdStdoutAndRecord(cmdData, true);
     CmdCauseAppExit(vCmd);
     CmdDelete(cmdData.id);
 
@@ -223,10 +280,22 @@ bool CMICmdInvoker::CmdExecuteFinished(CMICmdBase &vCmd) {
   // Command finished now get the command to gather it's information and form
   // the MI
   // Result record
-  if (!vCmd.Acknowledge()) {
+  bool bAcknowledged = false;
+  {
+    const CMICmnMIValueArena::CScope arenaScope(
+        CmdGetArena(vCmd.GetCmdData().id));
+    const CMICmdStats::TimePoint_t tmStart = CMICmdStats::Now();
+    bAcknowledged = vCmd.Acknowledge();
+    MapCmdIdToSample_t::iterator it =
+        m_mapCmdIdToSample.find(vCmd.GetCmdData().id);
+    if (it != m_mapCmdIdToSample.end())
+      it->second.anPhaseNs[CMICmdStats::ePhase_Acknowledge] =
+          CMICmdStats::ElapsedNs(tmStart, CMICmdStats::Now());
+  }
+  if (!bAcknowledged) {
     // Report command acknowledge functionality failed
     const SMICmdData cmdData(vCmd.GetCmdData());
-    CmdStdout(cmdData);
+    CmdStdoutAndRecord(cmdData, true);
     CmdCauseAppExit(vCmd);
     CmdDelete(cmdData.id);
 
@@ -251,7 +320,7 @@ bool CMICmdInvoker::CmdExecuteFinished(CMICmdBase &vCmd) {
   }
 
   // Send command's MI response to the client
-  bool bOk = CmdStdout(cmdData);
+  bool bOk = CmdStdoutAndRecord(cmdData, false);
 
   // Delete the command object as do not require anymore
   bOk = bOk && CmdDelete(vCmd.GetCmdData().id);
@@ -300,6 +369,54 @@ bool CMICmdInvoker::CmdStdout(const SMICmdData &vCmdData) const {
   return bOk;
 }
 
+//++
+// Details: Write the command's MI formatted result as CmdStdout() does then
+//          count the command's timings in the statistics.
+// Type:    Method.
+// Args:    vCmdData    - (R) A command's information.
+//          vbFailed    - (R) True = command reported an error, false = it
+//                        succeeded.
+// Return:  MIstatus::success - Functionality succeeded.
+//          MIstatus::failure - Functionality failed.
+// Throws:  None.
+//--
+bool CMICmdInvoker::CmdStdoutAndRecord(const SMICmdData &vCmdData,
+                                       const bool vbFailed) {
+  const CMICmdStats::TimePoint_t tmStart = CMICmdStats::Now();
+  const bool bOk = CmdStdout(vCmdData);
+  const CMICmdStats::TimePoint_t tmEnd = CMICmdStats::Now();
+
+  MapCmdIdToSample_t::iterator it = m_mapCmdIdToSample.find(vCmdData.id);
+  if (it == m_mapCmdIdToSample.end())
+    return bOk;
+  CMICmdStats::SSample &rSample = it->second;
+  rSample.anPhaseNs[CMICmdStats::ePhase_Buffer] =
+      CMICmdStats::ElapsedNs(tmStart, tmEnd);
+  rSample.anPhaseNs[CMICmdStats::ePhase_Total] =
+      CMICmdStats::ElapsedNs(rSample.tmStart, tmEnd);
+  rSample.nBytes = vCmdData.strMiCmdResultRecord.size();
+  if (vCmdData.bHasResultRecordExtra)
+    rSample.nBytes += vCmdData.strMiCmdResultRecordExtra.size();
+  const CMICmnMIValueArena *pArena = CmdGetArena(vCmdData.id);
+  if (pArena != nullptr) {
+    rSample.nBuffersReused = pArena->GetReuseCount();
+    rSample.nBuffersSpare = pArena->GetSpareCount();
+  }
+  rSample.bFailed = vbFailed;
+  m_stats.Add(vCmdData.strMiCmd, rSample);
+
+  return bOk;
+}
+
+//++
+// Details: Retrieve the latency statistics of the commands run so far.
+// Type:    Method.
+// Args:    None.
+// Return:  CMICmdStats & - The statistics.
+// Throws:  None.
+//--
+CMICmdStats &CMICmdInvoker::GetStats() { return m_stats; }
+
 //++
 // Details: Required by the CMICmdMgr::ICmdDeleteCallback. *this object is
 // registered
@@ -14,11 +14,13 @@
 // In-house headers:
 #include "MICmdData.h"
 #include "MICmdMgrSetCmdDeleteCallback.h"
+#include "MICmdStats.h"
 #include "MICmnBase.h"
 #include "MIUtilSingletonBase.h"
 
 // Declarations:
 class CMICmdBase;
+class CMICmnMIValueArena;
 class CMICmnStreamStdout;
 
 //++
@@ -72,11 +74,14 @@ public:
   bool Shutdown() override;
   bool CmdExecute(CMICmdBase &vCmd);
   bool CmdExecuteFinished(CMICmdBase &vCmd);
+  CMICmdStats &GetStats();
 
   // Typedefs:
 private:
   typedef std::map<MIuint, CMICmdBase *> MapCmdIdToCmd_t;
   typedef std::pair<MIuint, CMICmdBase *> MapPairCmdIdToCmd_t;
+  typedef std::map<MIuint, CMICmnMIValueArena *> MapCmdIdToArena_t;
+  typedef std::map<MIuint, CMICmdStats::SSample> MapCmdIdToSample_t;
 
   // Methods:
 private:
@@ -86,7 +91,13 @@ private:
   void CmdDeleteAll();
   bool CmdDelete(const MIuint vCmdId, const bool vbYesDeleteCmd = false);
   bool CmdAdd(const CMICmdBase &vCmd);
+  CMICmnMIValueArena *CmdGetArena(const MIuint vCmdId) const;
+  void CmdSetPhaseTimes(const MIuint vCmdId,
+                        const CMICmdStats::TimePoint_t &vtmStart,
+                        const CMICmdStats::TimePoint_t &vtmParsed,
+                        const CMICmdStats::TimePoint_t &vtmExecuted);
   bool CmdStdout(const SMICmdData &vCmdData) const;
+  bool CmdStdoutAndRecord(const SMICmdData &vCmdData, const bool vbFailed);
   void CmdCauseAppExit(const CMICmdBase &vCmd) const;
 
   // Overridden:
@@ -99,5 +110,9 @@ private:
   // Attributes:
 private:
   MapCmdIdToCmd_t m_mapCmdIdToCmd;
+  MapCmdIdToArena_t m_mapCmdIdToArena; // MI values a command forms reuse
+                                       // buffers from its arena
+  MapCmdIdToSample_t m_mapCmdIdToSample; // Timings of the commands doing work
+  CMICmdStats m_stats;
   CMICmnStreamStdout &m_rStreamOut;
 };
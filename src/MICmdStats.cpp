@@ -0,0 +1,186 @@
+//===-- MICmdStats.cpp ------------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// In-house headers:
+#include "MICmdStats.h"
+#include "MICmnMIValueBuilder.h"
+
+//++
+// Details: SSample constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdStats::SSample::SSample()
+    : tmStart(Now()), anPhaseNs(), nBytes(0), nBuffersReused(0),
+      nBuffersSpare(0), bFailed(false) {}
+
+//++
+// Details: SCmdStats constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdStats::SCmdStats::SCmdStats()
+    : nFailed(0), nBytes(0), nBuffersReused(0), nBuffersSpare(0) {}
+
+//++
+// Details: CMICmdStats constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmdStats::CMICmdStats() {}
+
+//++
+// Details: Retrieve the current time of the monotonic clock commands are timed
+//          with.
+// Type:    Static method.
+// Args:    None.
+// Return:  TimePoint_t - Now.
+// Throws:  None.
+//--
+CMICmdStats::TimePoint_t CMICmdStats::Now() {
+  return std::chrono::steady_clock::now();
+}
+
+//++
+// Details: Retrieve the time between two points in nanoseconds.
+// Type:    Static method.
+// Args:    vFrom   - (R) Earlier time.
+//          vTo     - (R) Later time.
+// Return:  MIuint64 - Nanoseconds, 0 = vTo is not after vFrom.
+// Throws:  None.
+//--
+MIuint64 CMICmdStats::ElapsedNs(const TimePoint_t &vFrom,
+                                const TimePoint_t &vTo) {
+  if (vTo <= vFrom)
+    return 0;
+  return static_cast<MIuint64>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(vTo - vFrom)
+          .count());
+}
+
+//++
+// Details: Retrieve the name a phase is given in the MI statistics.
+// Type:    Static method.
+// Args:    veType  - (R) The phase.
+// Return:  const char * - Phase name.
+// Throws:  None.
+//--
+const char *CMICmdStats::GetPhaseName(const Phase_e veType) {
+  switch (veType) {
+  case ePhase_Args:
+    return "args";
+  case ePhase_Execute:
+    return "execute";
+  case ePhase_Acknowledge:
+    return "acknowledge";
+  case ePhase_Buffer:
+    return "buffer";
+  case ePhase_Total:
+    return "total";
+  case ePhase_count:
+    break;
+  }
+  return "";
+}
+
+//++
+// Details: Count the timings of a command that has finished.
+// Type:    Method.
+// Args:    vCmdName    - (R) MI command name.
+//          vSample     - (R) The command's timings.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdStats::Add(const CMIUtilString &vCmdName, const SSample &vSample) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  SCmdStats &rStats = m_mapCmdNameToStats[vCmdName];
+  if (vSample.bFailed)
+    ++rStats.nFailed;
+  rStats.nBytes += vSample.nBytes;
+  rStats.nBuffersReused += vSample.nBuffersReused;
+  rStats.nBuffersSpare += vSample.nBuffersSpare;
+  for (MIuint i = 0; i < ePhase_count; ++i)
+    rStats.aPhase[i].Add(vSample.anPhaseNs[i]);
+}
+
+//++
+// Details: Forget the statistics gathered so far.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdStats::Reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_mapCmdNameToStats.clear();
+}
+
+//++
+// Details: Form the statistics gathered so far as a MI list with a tuple for
+//          each command name, in name order:
+//          [{name="...",count="N",failed="N",bytes="N",
+//          arena={reused="N",spare="N"},
+//          total={p50="N",p99="N",max="N"},args={...},execute={...},
+//          acknowledge={...},buffer={...}},...]
+//          Times are in nanoseconds.
+// Type:    Method.
+// Args:    vwText  - (W) Text to append the list to.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmdStats::GetMIText(CMIUtilString &vwText) const {
+  static const Phase_e arrPhases[] = {ePhase_Total, ePhase_Args,
+                                      ePhase_Execute, ePhase_Acknowledge,
+                                      ePhase_Buffer};
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  CMICmnMIValueBuilder builder(vwText);
+  builder.OpenList();
+  for (const auto &rNameStats : m_mapCmdNameToStats) {
+    const SCmdStats &rStats = rNameStats.second;
+    builder.OpenTuple();
+    builder.Result("name");
+    builder.Const(rNameStats.first);
+    builder.Result("count");
+    builder.Const(CMIUtilString::FormatTyped(
+        "%llu", rStats.aPhase[ePhase_Total].GetCount()));
+    builder.Result("failed");
+    builder.Const(CMIUtilString::FormatTyped("%llu", rStats.nFailed));
+    builder.Result("bytes");
+    builder.Const(CMIUtilString::FormatTyped("%llu", rStats.nBytes));
+    builder.Result("arena");
+    builder.OpenTuple();
+    builder.Result("reused");
+    builder.Const(CMIUtilString::FormatTyped("%llu", rStats.nBuffersReused));
+    builder.Result("spare");
+    builder.Const(CMIUtilString::FormatTyped("%llu", rStats.nBuffersSpare));
+    builder.CloseTuple();
+    for (const Phase_e ePhase : arrPhases) {
+      const CMIUtilHistogram &rHistogram = rStats.aPhase[ePhase];
+      builder.Result(GetPhaseName(ePhase));
+      builder.OpenTuple();
+      builder.Result("p50");
+      builder.Const(
+          CMIUtilString::FormatTyped("%llu", rHistogram.GetPercentile(50)));
+      builder.Result("p99");
+      builder.Const(
+          CMIUtilString::FormatTyped("%llu", rHistogram.GetPercentile(99)));
+      builder.Result("max");
+      builder.Const(CMIUtilString::FormatTyped("%llu", rHistogram.GetMax()));
+      builder.CloseTuple();
+    }
+    builder.CloseTuple();
+  }
+  builder.CloseList();
+}
@@ -0,0 +1,103 @@
+//===-- MICmdStats.h --------------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <chrono>
+#include <map>
+#include <mutex>
+
+// In-house headers:
+#include "MIDataTypes.h"
+#include "MIUtilHistogram.h"
+#include "MIUtilString.h"
+
+//++
+//============================================================================
+// Details: MI command latency statistics. The Invoker times each phase of
+//          every command it runs and hands the timings to *this object which
+//          keeps a histogram per phase for each command name. Adding a sample
+//          costs a map look up and a few counter increments so the
+//          statistics are always gathered.
+//          The statistics are given to the client by the MI command
+//          "lldb-mi-stats".
+//--
+class CMICmdStats {
+  // Enumerations:
+public:
+  //++
+  // Details: The phases of a command's life the Invoker times.
+  //--
+  enum Phase_e {
+    ePhase_Args = 0,    // AddArgs() and ParseArgs()
+    ePhase_Execute,     // Execute()
+    ePhase_Acknowledge, // Acknowledge()
+    ePhase_Buffer,      // Handing the result record(s) to the stdout buffer
+    ePhase_Total,       // Start of argument parsing to end of buffering
+    ePhase_count        // Always the last one
+  };
+
+  // Typedefs:
+public:
+  typedef std::chrono::steady_clock::time_point TimePoint_t;
+
+  // Structs:
+public:
+  //++
+  // Details: The timings of one command.
+  //--
+  struct SSample {
+    /* ctor */ SSample();
+    //
+    TimePoint_t tmStart; // When the Invoker started the command
+    MIuint64 anPhaseNs[ePhase_count]; // Time spent in each phase
+    MIuint64 nBytes;                  // Length of the result record(s)
+    MIuint64 nBuffersReused; // Value buffers taken from the command's arena
+    MIuint64 nBuffersSpare;  // Buffers left unused in the arena at the end
+    bool bFailed; // True = command reported an error, false = it succeeded
+  };
+
+  // Statics:
+public:
+  static TimePoint_t Now();
+  static MIuint64 ElapsedNs(const TimePoint_t &vFrom, const TimePoint_t &vTo);
+  static const char *GetPhaseName(const Phase_e veType);
+
+  // Methods:
+public:
+  /* ctor */ CMICmdStats();
+  //
+  void Add(const CMIUtilString &vCmdName, const SSample &vSample);
+  void Reset();
+  void GetMIText(CMIUtilString &vwText) const;
+
+  // Structs:
+private:
+  //++
+  // Details: The statistics gathered for one command name.
+  //--
+  struct SCmdStats {
+    /* ctor */ SCmdStats();
+    //
+    MIuint64 nFailed;
+    MIuint64 nBytes;
+    MIuint64 nBuffersReused;
+    MIuint64 nBuffersSpare;
+    CMIUtilHistogram aPhase[ePhase_count];
+  };
+
+  // Typedefs:
+private:
+  typedef std::map<CMIUtilString, SCmdStats> MapCmdNameToStats_t;
+
+  // Attributes:
+private:
+  MapCmdNameToStats_t m_mapCmdNameToStats;
+  mutable std::mutex m_mutex; // Commands can finish in another thread
+};
@@ -9,6 +9,7 @@
 // Third party headers:
 #include "lldb/API/SBThread.h"
 #include <cassert>
+#include <cctype>
 #include <inttypes.h>
 #ifdef _WIN32
 #include <algorithm>
@@ -38,6 +39,22 @@
 #endif // _WIN32
 #define RETURNED_PATH_SEPARATOR "/"
 
+//++
+// Details: Check text is an identifier, the only form a variable's name takes.
+// Type:    Function.
+// Args:    vrText  - (R) The text.
+// Return:  bool - True = an identifier, false = empty or an expression.
+// Throws:  None.
+//--
+static bool IsIdentifier(const CMIUtilString &vrText) {
+  if (vrText.empty() || (::isdigit(static_cast<unsigned char>(vrText[0])) != 0))
+    return false;
+  for (const char c : vrText)
+    if ((c != '_') && (::isalnum(static_cast<unsigned char>(c)) == 0))
+      return false;
+  return true;
+}
+
 //++
 // Details: CMICmnLLDBDebugSessionInfo destructor.
 // Type:    Overridable.
@@ -115,6 +132,10 @@ void CMICmnLLDBDebugSessionInfo::SharedDataDestroy() {
   m_vecVarObj.clear();
   m_mapMiStoppointIdToStoppointInfo.clear();
   m_mapLldbStoppointIdToMiStoppointId.clear();
+  SnapshotInvalidate();
+  m_bFrameVarsValid = false;
+  m_mapFrameVars.clear();
+  ResolvePathCacheClear();
 }
 
 //++
@@ -303,7 +324,9 @@ bool CMICmnLLDBDebugSessionInfo::ResolvePath(const SMICmdData &vCmdData,
 }
 
 //++
-// Details: Return the resolved file's path for the given file.
+// Details: Return the resolved file's path for the given file. Each path is
+//          searched for once, what was found, or not found, is given again
+//          until ResolvePathCacheClear() is called.
 // Type:    Method.
 // Args:    vstrUnknown     - (R)   String assigned to path when resolved path
 // is empty.
@@ -320,6 +343,75 @@ bool CMICmnLLDBDebugSessionInfo::ResolvePath(const CMIUtilString &vstrUnknown,
     return MIstatus::success;
   }
 
+  const MapPathToResolvedPath_t::const_iterator it =
+      m_mapResolvedPath.find(vwrResolvedPath);
+  if (it != m_mapResolvedPath.end()) {
+    ++m_nResolvedPathHits;
+    vwrResolvedPath = it->second;
+    return MIstatus::success;
+  }
+
+  ++m_nResolvedPathMisses;
+  const CMIUtilString strDebugInfoPath(vwrResolvedPath);
+  if (!ResolvePathSearch(vwrResolvedPath))
+    return MIstatus::failure;
+
+  m_mapResolvedPath[strDebugInfoPath] = vwrResolvedPath;
+  return MIstatus::success;
+}
+
+//++
+// Details: Forget the paths ResolvePath() has resolved, i.e. because the
+//          working directory or the solib search path has changed.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfo::ResolvePathCacheClear() {
+  m_mapResolvedPath.clear();
+}
+
+//++
+// Details: Retrieve how many paths ResolvePath() gave from those already
+//          resolved and how many it had to search for.
+// Type:    Method.
+// Args:    vwnHits     - (W) Number of paths already resolved.
+//          vwnMisses   - (W) Number of paths searched for.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfo::ResolvePathCacheGetCounts(
+    MIuint64 &vwnHits, MIuint64 &vwnMisses) const {
+  vwnHits = m_nResolvedPathHits;
+  vwnMisses = m_nResolvedPathMisses;
+}
+
+//++
+// Details: Set the counts given by ResolvePathCacheGetCounts() to zero.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfo::ResolvePathCacheResetCounts() {
+  m_nResolvedPathHits = 0;
+  m_nResolvedPathMisses = 0;
+}
+
+//++
+// Details: Search the file system for the given file. The file, then the file
+//          with more and more of its folders, is tried until a path that
+//          exists is found.
+// Type:    Method.
+// Args:    vwrResolvedPath - (RW)  The original path overwritten with resolved
+//          path.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmnLLDBDebugSessionInfo::ResolvePathSearch(
+    CMIUtilString &vwrResolvedPath) {
   bool bOk = MIstatus::success;
 
 #ifdef _WIN32
@@ -395,7 +487,8 @@ bool CMICmnLLDBDebugSessionInfo::AccessPath(const CMIUtilString &vPath,
 //++
 // Details: Form MI partial response by appending more MI value type objects to
 // the
-//          tuple type object past in.
+//          tuple type object past in. The text formed is kept in the stop
+//          snapshot and reused while the process stays stopped.
 // Type:    Method.
 // Args:    vCmdData        - (R) A command's information.
 //          vrThread        - (R) LLDB thread object.
@@ -410,6 +503,17 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormThreadInfo(
     CMICmnMIValueTuple &vwrMIValueTuple) {
   lldb::SBThread &rThread = const_cast<lldb::SBThread &>(vrThread);
 
+  const bool bSnapshot = SnapshotIsCurrent();
+  const SnapshotThreadKey_t key(rThread.GetIndexID(), veThreadInfoFormat);
+  if (bSnapshot) {
+    const auto it = m_mapSnapshotThreads.find(key);
+    if (it != m_mapSnapshotThreads.end()) {
+      vwrMIValueTuple.Add(CMICmnMIValueConst(it->second, true), false);
+      return MIstatus::success;
+    }
+  }
+
+  CMICmnMIValueTuple miValueTuple;
   const bool bSuspended = rThread.IsSuspended();
   const lldb::StopReason eReason = rThread.GetStopReason();
   const bool bValidReason = !((eReason == lldb::eStopReasonNone) ||
@@ -418,10 +522,11 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormThreadInfo(
                                                             : "running");
 
   // Add "id"
-  const CMIUtilString strId(CMIUtilString::Format("%d", rThread.GetIndexID()));
+  const CMIUtilString strId(
+      CMIUtilString::FormatTyped("%d", rThread.GetIndexID()));
   const CMICmnMIValueConst miValueConst1(strId);
   const CMICmnMIValueResult miValueResult1("id", miValueConst1);
-  vwrMIValueTuple.Add(miValueResult1);
+  miValueTuple.Add(miValueResult1);
 
   // Add "target-id"
   const char *pThreadName = rThread.GetName();
@@ -436,7 +541,7 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormThreadInfo(
     strThread = CMIUtilString::Format(pThrdFmt, rThread.GetIndexID());
   const CMICmnMIValueConst miValueConst2(strThread);
   const CMICmnMIValueResult miValueResult2("target-id", miValueConst2);
-  vwrMIValueTuple.Add(miValueResult2);
+  miValueTuple.Add(miValueResult2);
 
   // Add "frame"
   if (veThreadInfoFormat != eThreadInfoFormat_NoFrames) {
@@ -446,13 +551,18 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormThreadInfo(
       return MIstatus::failure;
 
     const CMICmnMIValueConst miValueConst3(strFrames, true);
-    vwrMIValueTuple.Add(miValueConst3, false);
+    miValueTuple.Add(miValueConst3, false);
   }
 
   // Add "state"
   const CMICmnMIValueConst miValueConst4(strState);
   const CMICmnMIValueResult miValueResult4("state", miValueConst4);
-  vwrMIValueTuple.Add(miValueResult4);
+  miValueTuple.Add(miValueResult4);
+
+  const CMIUtilString strTuple(miValueTuple.ExtractContentNoBrackets());
+  if (bSnapshot)
+    m_mapSnapshotThreads[key] = strTuple;
+  vwrMIValueTuple.Add(CMICmnMIValueConst(strTuple, true), false);
 
   return MIstatus::success;
 }
@@ -537,7 +647,7 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseForVariableInfoInternal(
         CMIUtilString strValue;
         if (GetVariableInfo(value, vnMaxDepth == 0, strValue)) {
           const CMICmnMIValueConst miValueConst2(
-              strValue.Escape().AddSlashes());
+              strValue.EscapeAndAddSlashes());
           const CMICmnMIValueResult miValueResult2("value", miValueConst2);
           miValueTuple.Add(miValueResult2);
         }
@@ -585,7 +695,8 @@ bool CMICmnLLDBDebugSessionInfo::GetVariableInfo(const lldb::SBValue &vrValue,
 //++
 // Details: Form MI partial response by appending more MI value type objects to
 // the
-//          tuple type object past in.
+//          tuple type object past in. The text formed is kept in the stop
+//          snapshot and reused while the process stays stopped.
 // Type:    Method.
 // Args:    vrThread        - (R) LLDB thread object.
 //          vwrMIValueTuple - (W) MI value tuple object.
@@ -600,6 +711,17 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormFrameInfo(
     CMICmnMIValueTuple &vwrMiValueTuple) {
   lldb::SBThread &rThread = const_cast<lldb::SBThread &>(vrThread);
 
+  const bool bSnapshot = SnapshotIsCurrent();
+  const SnapshotFrameKey_t key(rThread.GetIndexID(), vnLevel,
+                               veFrameInfoFormat);
+  if (bSnapshot) {
+    const auto it = m_mapSnapshotFrames.find(key);
+    if (it != m_mapSnapshotFrames.end()) {
+      vwrMiValueTuple.Add(CMICmnMIValueConst(it->second, true), false);
+      return MIstatus::success;
+    }
+  }
+
   lldb::SBFrame frame = rThread.GetFrameAtIndex(vnLevel);
   lldb::addr_t pc = 0;
   CMIUtilString fnName;
@@ -609,19 +731,21 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormFrameInfo(
   if (!GetFrameInfo(frame, pc, fnName, fileName, path, nLine))
     return MIstatus::failure;
 
+  CMICmnMIValueTuple miValueTuple;
+
   // MI print "{level=\"0\",addr=\"0x%016" PRIx64
   // "\",func=\"%s\",file=\"%s\",fullname=\"%s\",line=\"%d\"}"
-  const CMIUtilString strLevel(CMIUtilString::Format("%d", vnLevel));
+  const CMIUtilString strLevel(CMIUtilString::FormatTyped("%d", vnLevel));
   const CMICmnMIValueConst miValueConst(strLevel);
   const CMICmnMIValueResult miValueResult("level", miValueConst);
-  vwrMiValueTuple.Add(miValueResult);
-  const CMIUtilString strAddr(CMIUtilString::Format("0x%016" PRIx64, pc));
+  miValueTuple.Add(miValueResult);
+  const CMIUtilString strAddr(CMIUtilString::FormatTyped("0x%016" PRIx64, pc));
   const CMICmnMIValueConst miValueConst2(strAddr);
   const CMICmnMIValueResult miValueResult2("addr", miValueConst2);
-  vwrMiValueTuple.Add(miValueResult2);
+  miValueTuple.Add(miValueResult2);
   const CMICmnMIValueConst miValueConst3(fnName);
   const CMICmnMIValueResult miValueResult3("func", miValueConst3);
-  vwrMiValueTuple.Add(miValueResult3);
+  miValueTuple.Add(miValueResult3);
   if (veFrameInfoFormat != eFrameInfoFormat_NoArguments) {
     CMICmnMIValueList miValueList(true);
     const MIuint maskVarTypes = eVariableType_Arguments;
@@ -636,18 +760,23 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormFrameInfo(
       return MIstatus::failure;
 
     const CMICmnMIValueResult miValueResult4("args", miValueList);
-    vwrMiValueTuple.Add(miValueResult4);
+    miValueTuple.Add(miValueResult4);
   }
   const CMICmnMIValueConst miValueConst5(fileName);
   const CMICmnMIValueResult miValueResult5("file", miValueConst5);
-  vwrMiValueTuple.Add(miValueResult5);
+  miValueTuple.Add(miValueResult5);
   const CMICmnMIValueConst miValueConst6(path);
   const CMICmnMIValueResult miValueResult6("fullname", miValueConst6);
-  vwrMiValueTuple.Add(miValueResult6);
-  const CMIUtilString strLine(CMIUtilString::Format("%d", nLine));
+  miValueTuple.Add(miValueResult6);
+  const CMIUtilString strLine(CMIUtilString::FormatTyped("%d", nLine));
   const CMICmnMIValueConst miValueConst7(strLine);
   const CMICmnMIValueResult miValueResult7("line", miValueConst7);
-  vwrMiValueTuple.Add(miValueResult7);
+  miValueTuple.Add(miValueResult7);
+
+  const CMIUtilString strTuple(miValueTuple.ExtractContentNoBrackets());
+  if (bSnapshot)
+    m_mapSnapshotFrames[key] = strTuple;
+  vwrMiValueTuple.Add(CMICmnMIValueConst(strTuple, true), false);
 
   return MIstatus::success;
 }
@@ -707,7 +836,7 @@ void CMICmnLLDBDebugSessionInfo::MIResponseFormStoppointFrameInfo(
     const SStoppointInfo &vrStoppointInfo,
     CMICmnMIValueTuple &vwrMiValueTuple) {
   const CMIUtilString strAddr(
-      CMIUtilString::Format("0x%016" PRIx64, vrStoppointInfo.m_addr));
+      CMIUtilString::FormatTyped("0x%016" PRIx64, vrStoppointInfo.m_addr));
   const CMICmnMIValueConst miValueConst2(strAddr);
   const CMICmnMIValueResult miValueResult2("addr", miValueConst2);
   vwrMiValueTuple.Add(miValueResult2);
@@ -718,13 +847,13 @@ void CMICmnLLDBDebugSessionInfo::MIResponseFormStoppointFrameInfo(
   const CMICmnMIValueResult miValueResult5("file", miValueConst5);
   vwrMiValueTuple.Add(miValueResult5);
   const CMIUtilString strN5 =
-      CMIUtilString::Format("%s/%s", vrStoppointInfo.m_path.c_str(),
-                            vrStoppointInfo.m_fileName.c_str());
+      CMIUtilString::FormatTyped("%s/%s", vrStoppointInfo.m_path,
+                                 vrStoppointInfo.m_fileName);
   const CMICmnMIValueConst miValueConst6(strN5);
   const CMICmnMIValueResult miValueResult6("fullname", miValueConst6);
   vwrMiValueTuple.Add(miValueResult6);
   const CMIUtilString strLine(
-      CMIUtilString::Format("%d", vrStoppointInfo.m_nLine));
+      CMIUtilString::FormatTyped("%d", vrStoppointInfo.m_nLine));
   const CMICmnMIValueConst miValueConst7(strLine);
   const CMICmnMIValueResult miValueResult7("line", miValueConst7);
   vwrMiValueTuple.Add(miValueResult7);
@@ -751,7 +880,7 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormBreakpointInfo(
 
   // "number="
 
-  const CMICmnMIValueConst miValueConst(CMIUtilString::Format(
+  const CMICmnMIValueConst miValueConst(CMIUtilString::FormatTyped(
       "%" PRIu64, static_cast<uint64_t>(vrStoppointInfo.m_nMiId)));
   const CMICmnMIValueResult miValueResult("number", miValueConst);
   CMICmnMIValueTuple miValueTuple(miValueResult);
@@ -786,13 +915,14 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormBreakpointInfo(
   }
   // "times="
   const CMICmnMIValueConst miValueConstB(
-      CMIUtilString::Format("%d", vrStoppointInfo.m_nTimes));
+      CMIUtilString::FormatTyped("%d", vrStoppointInfo.m_nTimes));
   const CMICmnMIValueResult miValueResultB("times", miValueConstB);
   miValueTuple.Add(miValueResultB);
   // "thread="
   if (vrStoppointInfo.m_bBreakpointThreadId) {
     const CMICmnMIValueConst miValueConst(
-        CMIUtilString::Format("%d", vrStoppointInfo.m_nBreakpointThreadId));
+        CMIUtilString::FormatTyped("%d",
+                                   vrStoppointInfo.m_nBreakpointThreadId));
     const CMICmnMIValueResult miValueResult("thread", miValueConst);
     miValueTuple.Add(miValueResult);
   }
@@ -805,7 +935,7 @@ bool CMICmnLLDBDebugSessionInfo::MIResponseFormBreakpointInfo(
   // "ignore="
   if (vrStoppointInfo.m_nIgnore != 0) {
     const CMICmnMIValueConst miValueConst(
-        CMIUtilString::Format("%d", vrStoppointInfo.m_nIgnore));
+        CMIUtilString::FormatTyped("%d", vrStoppointInfo.m_nIgnore));
     const CMICmnMIValueResult miValueResult("ignore", miValueConst);
     miValueTuple.Add(miValueResult);
   }
@@ -847,7 +977,7 @@ void CMICmnLLDBDebugSessionInfo::MIResponseFormWatchpointInfo(
     const SStoppointInfo &vrStoppointInfo,
     CMICmnMIValueResult &vwrMiValueResult) {
   // "number="
-  const CMICmnMIValueConst miValueConstNumber(CMIUtilString::Format(
+  const CMICmnMIValueConst miValueConstNumber(CMIUtilString::FormatTyped(
       "%" PRIu64, static_cast<uint64_t>(vrStoppointInfo.m_nMiId)));
   const CMICmnMIValueResult miValueResultNumber("number", miValueConstNumber);
   CMICmnMIValueTuple miValueTuple(miValueResultNumber);
@@ -1015,6 +1145,150 @@ lldb::SBProcess CMICmnLLDBDebugSessionInfo::GetProcess() const {
   return GetTarget().GetProcess();
 }
 
+//++
+// Details: Forget the MI text formed for the frames and threads of the stopped
+//          process. To be called when something changes what the text would
+//          be but does not change the process's stop ID, i.e. a variable or
+//          memory is written.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfo::SnapshotInvalidate() {
+  m_bSnapshotValid = false;
+  m_mapSnapshotFrames.clear();
+  m_mapSnapshotThreads.clear();
+}
+
+//++
+// Details: Check the snapshot can be used, i.e. the process is stopped and has
+//          not run since the snapshot was started. A new snapshot is started
+//          if the process has stopped again.
+// Type:    Method.
+// Args:    None.
+// Return:  bool - True = use the snapshot, false = the process is not stopped.
+// Throws:  None.
+//--
+bool CMICmnLLDBDebugSessionInfo::SnapshotIsCurrent() {
+  lldb::SBProcess process = GetProcess();
+  if (!process.IsValid() || (process.GetState() != lldb::eStateStopped)) {
+    if (m_bSnapshotValid)
+      SnapshotInvalidate();
+    return false;
+  }
+
+  // Expression stops count as they may have changed memory
+  const bool include_expression_stops = true;
+  const MIuint nProcessId = process.GetUniqueID();
+  const MIuint nStopId = process.GetStopID(include_expression_stops);
+  if (m_bSnapshotValid && (m_nSnapshotProcessId == nProcessId) &&
+      (m_nSnapshotStopId == nStopId))
+    return true;
+
+  SnapshotInvalidate();
+  m_bSnapshotValid = true;
+  m_nSnapshotProcessId = nProcessId;
+  m_nSnapshotStopId = nStopId;
+  return true;
+}
+
+//++
+// Details: Check the index of the frames' variables can be used, i.e. the
+//          process is stopped and has not run since the index was started,
+//          other than to evaluate expressions. The variables' values are
+//          live so an expression writing to them does not make them stale.
+//          A new index is started if the process has stopped again.
+// Type:    Method.
+// Args:    None.
+// Return:  bool - True = use the index, false = the process is not stopped.
+// Throws:  None.
+//--
+bool CMICmnLLDBDebugSessionInfo::FrameVarsIsCurrent() {
+  lldb::SBProcess process = GetProcess();
+  if (!process.IsValid() || (process.GetState() != lldb::eStateStopped)) {
+    if (m_bFrameVarsValid) {
+      m_bFrameVarsValid = false;
+      m_mapFrameVars.clear();
+    }
+    return false;
+  }
+
+  const bool include_expression_stops = false;
+  const MIuint nProcessId = process.GetUniqueID();
+  const MIuint nStopId = process.GetStopID(include_expression_stops);
+  if (m_bFrameVarsValid && (m_nFrameVarsProcessId == nProcessId) &&
+      (m_nFrameVarsStopId == nStopId))
+    return true;
+
+  m_mapFrameVars.clear();
+  m_bFrameVarsValid = true;
+  m_nFrameVarsProcessId = nProcessId;
+  m_nFrameVarsStopId = nStopId;
+  return true;
+}
+
+//++
+// Details: Find an argument, local or static variable in scope in a frame by
+//          name. The frame is asked for the variable of its blocks first.
+//          Failing that the frame's variables are put in an index by name,
+//          kept until the process runs, so they are not all made again for
+//          every name looked up. Names that are not identifiers, i.e.
+//          expressions, are never variables and are not looked for in the
+//          index.
+// Type:    Method.
+// Args:    vrFrame     - (R) The frame.
+//          vrName      - (R) The variable's name.
+//          vwrValue    - (W) The variable's value.
+// Return:  bool - True = found, false = no variable of that name.
+// Throws:  None.
+//--
+bool CMICmnLLDBDebugSessionInfo::GetFrameVariable(lldb::SBFrame &vrFrame,
+                                                  const CMIUtilString &vrName,
+                                                  lldb::SBValue &vrwValue) {
+  vrwValue = vrFrame.FindVariable(vrName.c_str());
+  if (vrwValue.IsValid())
+    return true;
+
+  if (!IsIdentifier(vrName))
+    return false;
+
+  const bool bArgs = true;
+  const bool bLocals = true;
+  const bool bStatics = true;
+  const bool bInScopeOnly = true;
+  if (!FrameVarsIsCurrent()) {
+    const lldb::SBValueList valueList =
+        vrFrame.GetVariables(bArgs, bLocals, bStatics, bInScopeOnly);
+    vrwValue = valueList.GetFirstValueByName(vrName.c_str());
+    return vrwValue.IsValid();
+  }
+
+  const FrameVarsKey_t key(vrFrame.GetThread().GetIndexID(),
+                           vrFrame.GetFrameID());
+  MapFrameVarsKeyToValues_t::iterator it = m_mapFrameVars.find(key);
+  if (it == m_mapFrameVars.end()) {
+    it = m_mapFrameVars.emplace(key, MapNameToValue_t()).first;
+    const lldb::SBValueList valueList =
+        vrFrame.GetVariables(bArgs, bLocals, bStatics, bInScopeOnly);
+    const MIuint nValues = valueList.GetSize();
+    for (MIuint i = 0; i < nValues; i++) {
+      lldb::SBValue value = valueList.GetValueAtIndex(i);
+      const char *pName = value.GetName();
+      // The first of a name is kept, as GetFirstValueByName() would find
+      if (pName != nullptr)
+        it->second.emplace(pName, value);
+    }
+  }
+
+  const MapNameToValue_t::const_iterator itValue = it->second.find(vrName);
+  if (itValue == it->second.end())
+    return false;
+
+  vrwValue = itValue->second;
+  return true;
+}
+
 //++
 // Details: Set flag that new inferiors should run in new ttys.
 // Type:    Method.
@@ -14,7 +14,10 @@
 #include "lldb/API/SBProcess.h"
 #include "lldb/API/SBTarget.h"
 #include <map>
+#include <string>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 // In-house headers:
@@ -168,6 +171,9 @@ public:
                    CMIUtilString &vwrResolvedPath);
   bool ResolvePath(const CMIUtilString &vstrUnknown,
                    CMIUtilString &vwrResolvedPath);
+  void ResolvePathCacheClear();
+  void ResolvePathCacheGetCounts(MIuint64 &vwnHits, MIuint64 &vwnMisses) const;
+  void ResolvePathCacheResetCounts();
   bool MIResponseFormFrameInfo(const lldb::SBThread &vrThread,
                                const MIuint vnLevel,
                                const FrameInfoFormat_e veFrameInfoFormat,
@@ -176,6 +182,8 @@ public:
                                 const lldb::SBThread &vrThread,
                                 const ThreadInfoFormat_e veThreadInfoFormat,
                                 CMICmnMIValueTuple &vwrMIValueTuple);
+  bool GetFrameVariable(lldb::SBFrame &vrFrame, const CMIUtilString &vrName,
+                        lldb::SBValue &vrwValue);
   bool MIResponseFormVariableInfo(const lldb::SBFrame &vrFrame,
                                   const MIuint vMaskVarTypes,
                                   const VariableInfoFormat_e veVarInfoFormat,
@@ -200,6 +208,7 @@ public:
                                   const StoppointType_e veStoppointType);
   bool RemoveLldbToMiStoppointIdMapping(const MIuint vnLldbStoppointId,
                                         const StoppointType_e veStoppointType);
+  void SnapshotInvalidate();
   CMIUtilThreadMutex &GetSessionMutex() { return m_sessionMutex; }
   lldb::SBDebugger &GetDebugger() const;
   lldb::SBListener &GetListener() const;
@@ -237,6 +246,22 @@ private:
       MapPairMiStoppointIdToStoppointInfo_t;
   typedef std::map<std::pair<MIuint, StoppointType_e>, MIuint>
       MapLldbStoppointIdToMiStoppointId_t;
+  typedef std::map<CMIUtilString, CMIUtilString> MapPathToResolvedPath_t;
+  // Thread index ID, frame level and format
+  typedef std::tuple<MIuint, MIuint, FrameInfoFormat_e> SnapshotFrameKey_t;
+  typedef std::map<SnapshotFrameKey_t, CMIUtilString>
+      MapSnapshotFrameKeyToText_t;
+  // Thread index ID and format
+  typedef std::pair<MIuint, ThreadInfoFormat_e> SnapshotThreadKey_t;
+  typedef std::map<SnapshotThreadKey_t, CMIUtilString>
+      MapSnapshotThreadKeyToText_t;
+  // Thread index ID and frame level
+  typedef std::pair<MIuint, MIuint> FrameVarsKey_t;
+  typedef std::unordered_map<CMIUtilString, lldb::SBValue,
+                             std::hash<std::string>>
+      MapNameToValue_t;
+  typedef std::map<FrameVarsKey_t, MapNameToValue_t>
+      MapFrameVarsKeyToValues_t;
 
   // Methods:
 private:
@@ -246,6 +271,7 @@ private:
   //
   bool GetVariableInfo(const lldb::SBValue &vrValue, const bool vbInSimpleForm,
                        CMIUtilString &vwrStrValue);
+  bool ResolvePathSearch(CMIUtilString &vwrResolvedPath);
   bool GetFrameInfo(const lldb::SBFrame &vrFrame, lldb::addr_t &vwPc,
                     CMIUtilString &vwFnName, CMIUtilString &vwFileName,
                     CMIUtilString &vwPath, MIuint &vwnLine);
@@ -258,6 +284,8 @@ private:
                                     const lldb::SBValueList &vwrSBValueList,
                                     const MIuint vnMaxDepth,
                                     const bool vbIsArgs, const bool vbMarkArgs);
+  bool SnapshotIsCurrent();
+  bool FrameVarsIsCurrent();
 
   // Overridden:
 private:
@@ -277,6 +305,23 @@ private:
   std::mutex m_miStoppointIdsMutex;
 
   bool m_bCreateTty = false; // Created inferiors should launch with new TTYs
+  // Snapshot of the stopped process, the MI text already formed for its frames
+  // and threads
+  bool m_bSnapshotValid = false;   // True = the maps are of the stop below
+  MIuint m_nSnapshotProcessId = 0; // LLDB unique ID of the process
+  MIuint m_nSnapshotStopId = 0;    // LLDB stop ID, expression stops included
+  MapSnapshotFrameKeyToText_t m_mapSnapshotFrames;
+  MapSnapshotThreadKeyToText_t m_mapSnapshotThreads;
+  // Variables of the frames by name, see GetFrameVariable(). Kept across
+  // expression stops, which do not change the frames' variables.
+  bool m_bFrameVarsValid = false;   // True = the map is of the stop below
+  MIuint m_nFrameVarsProcessId = 0; // LLDB unique ID of the process
+  MIuint m_nFrameVarsStopId = 0;    // LLDB stop ID, expression stops excluded
+  MapFrameVarsKeyToValues_t m_mapFrameVars;
+  // Debug info path to the path ResolvePath() gave for it, found or not
+  MapPathToResolvedPath_t m_mapResolvedPath;
+  MIuint64 m_nResolvedPathHits = 0;   // Paths given from m_mapResolvedPath
+  MIuint64 m_nResolvedPathMisses = 0; // Paths searched for on the file system
 };
 
 //++
@@ -296,6 +341,12 @@ private:
 template <typename T>
 bool CMICmnLLDBDebugSessionInfo::SharedDataAdd(const CMIUtilString &vKey,
                                                const T &vData) {
+  // Settings such as the print options change how frames are formed
+  SnapshotInvalidate();
+  if ((vKey == m_constStrSharedDataKeyWkDir) ||
+      (vKey == m_constStrSharedDataSolibPath))
+    ResolvePathCacheClear();
+
   if (!m_mapIdToSessionData.Add<T>(vKey, vData)) {
     SetErrorDescription(m_mapIdToSessionData.GetErrorDescription());
     return MIstatus::failure;
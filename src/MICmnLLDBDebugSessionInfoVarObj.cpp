@@ -6,6 +6,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+// Third Party Headers:
+#include "lldb/API/SBFrame.h"
+#include "lldb/API/SBThread.h"
+
 // In-house headers:
 #include "MICmnLLDBDebugSessionInfoVarObj.h"
 #include "MICmnLLDBProxySBValue.h"
@@ -21,8 +25,19 @@ const char *CMICmnLLDBDebugSessionInfoVarObj::ms_aVarFormatChars[] = {
     // CODETAG_SESSIONINFO_VARFORMAT_ENUM
     // *** Order is import here.
     "<Invalid var format>", "t", "o", "d", "x", "N"};
-CMICmnLLDBDebugSessionInfoVarObj::MapKeyToVarObj_t
-    CMICmnLLDBDebugSessionInfoVarObj::ms_mapVarIdToVarObj;
+CMICmnLLDBDebugSessionInfoVarObj::DequeVarObj_t
+    CMICmnLLDBDebugSessionInfoVarObj::ms_dequeVarObjSlots;
+CMICmnLLDBDebugSessionInfoVarObj::VecSlot_t
+    CMICmnLLDBDebugSessionInfoVarObj::ms_vecSlotGeneration;
+CMICmnLLDBDebugSessionInfoVarObj::VecSlot_t
+    CMICmnLLDBDebugSessionInfoVarObj::ms_vecSlotFree;
+CMICmnLLDBDebugSessionInfoVarObj::MapNameToHandle_t
+    CMICmnLLDBDebugSessionInfoVarObj::ms_mapNameToHandle;
+CMICmnLLDBDebugSessionInfoVarObj::MapUseToHandle_t
+    CMICmnLLDBDebugSessionInfoVarObj::ms_mapRootUseToHandle;
+MIuint64 CMICmnLLDBDebugSessionInfoVarObj::ms_nUseCount = 0;
+MIuint CMICmnLLDBDebugSessionInfoVarObj::ms_nLimit = 0; // No limit
+MIuint64 CMICmnLLDBDebugSessionInfoVarObj::ms_nEvicted = 0;
 MIuint CMICmnLLDBDebugSessionInfoVarObj::ms_nVarUniqueId = 0; // Index from 0
 CMICmnLLDBDebugSessionInfoVarObj::varFormat_e
     CMICmnLLDBDebugSessionInfoVarObj::ms_eDefaultFormat = eVarFormat_Natural;
@@ -36,7 +51,9 @@ CMICmnLLDBDebugSessionInfoVarObj::varFormat_e
 //--
 CMICmnLLDBDebugSessionInfoVarObj::CMICmnLLDBDebugSessionInfoVarObj()
     : m_eVarFormat(eVarFormat_Natural), m_eVarType(eVarType_Internal),
-      m_eValObjKind(valObjKind_ec::eValObjKind_Other), m_bChanged(false) {
+      m_eValObjKind(valObjKind_ec::eValObjKind_Other), m_bChanged(false),
+      m_nHandle(0), m_nParentHandle(0), m_nChildIndex(0), m_nLastUse(0),
+      m_nFrameThreadId(0), m_nFrameCfa(0) {
   // Do not call UpdateValue() in here as not necessary
 }
 
@@ -48,6 +65,8 @@ CMICmnLLDBDebugSessionInfoVarObj::CMICmnLLDBDebugSessionInfoVarObj()
 //          vrStrName       - (R) The name given for *this var object.
 //          vrValue         - (R) The LLDB SBValue object represented by *this
 //          object.
+//          The frame the value was created in is noted so the var objects of
+//          a frame can be updated together.
 // Return:  None.
 // Throws:  None.
 //--
@@ -56,7 +75,14 @@ CMICmnLLDBDebugSessionInfoVarObj::CMICmnLLDBDebugSessionInfoVarObj(
     const lldb::SBValue &vrValue, const valObjKind_ec eValObjKind)
     : m_eVarFormat(eVarFormat_Natural), m_eVarType(eVarType_Internal),
       m_eValObjKind(eValObjKind), m_strName(vrStrName), m_SBValue(vrValue),
-      m_strNameReal(vrStrNameReal), m_bChanged(false) {
+      m_strNameReal(vrStrNameReal), m_bChanged(false), m_nHandle(0),
+      m_nParentHandle(0), m_nChildIndex(0), m_nLastUse(0),
+      m_nFrameThreadId(0), m_nFrameCfa(0) {
+  const lldb::SBFrame frame = m_SBValue.GetFrame();
+  if (frame.IsValid()) {
+    m_nFrameThreadId = frame.GetThread().GetIndexID();
+    m_nFrameCfa = frame.GetCFA();
+  }
   UpdateValue();
 }
 
@@ -80,7 +106,9 @@ CMICmnLLDBDebugSessionInfoVarObj::CMICmnLLDBDebugSessionInfoVarObj(
     : m_eVarFormat(eVarFormat_Natural), m_eVarType(eVarType_Internal),
       m_eValObjKind(eValObjKind), m_strName(vrStrName), m_SBValue(vrValue),
       m_strNameReal(vrStrNameReal),
-      m_strVarObjParentName(vrStrVarObjParentName), m_bChanged(false) {
+      m_strVarObjParentName(vrStrVarObjParentName), m_bChanged(false),
+      m_nHandle(0), m_nParentHandle(0), m_nChildIndex(0), m_nLastUse(0),
+      m_nFrameThreadId(0), m_nFrameCfa(0) {
   UpdateValue();
 }
 
@@ -160,6 +188,13 @@ void CMICmnLLDBDebugSessionInfoVarObj::CopyOther(
   m_strFormattedValue = vrOther.m_strFormattedValue;
   m_strVarObjParentName = vrOther.m_strVarObjParentName;
   m_bChanged = vrOther.m_bChanged;
+  m_nHandle = vrOther.m_nHandle;
+  m_nParentHandle = vrOther.m_nParentHandle;
+  m_vecChildren = vrOther.m_vecChildren;
+  m_nChildIndex = vrOther.m_nChildIndex;
+  m_nLastUse = vrOther.m_nLastUse;
+  m_nFrameThreadId = vrOther.m_nFrameThreadId;
+  m_nFrameCfa = vrOther.m_nFrameCfa;
 }
 
 //++
@@ -180,6 +215,13 @@ void CMICmnLLDBDebugSessionInfoVarObj::MoveOther(
   m_strFormattedValue = std::move(vrwOther.m_strFormattedValue);
   m_strVarObjParentName = std::move(vrwOther.m_strVarObjParentName);
   m_bChanged = vrwOther.m_bChanged;
+  m_nHandle = vrwOther.m_nHandle;
+  m_nParentHandle = vrwOther.m_nParentHandle;
+  m_vecChildren = std::move(vrwOther.m_vecChildren);
+  m_nChildIndex = vrwOther.m_nChildIndex;
+  m_nLastUse = vrwOther.m_nLastUse;
+  m_nFrameThreadId = vrwOther.m_nFrameThreadId;
+  m_nFrameCfa = vrwOther.m_nFrameCfa;
 
   vrwOther.m_eVarFormat = eVarFormat_Natural;
   vrwOther.m_eVarType = eVarType_Internal;
@@ -190,6 +232,13 @@ void CMICmnLLDBDebugSessionInfoVarObj::MoveOther(
   vrwOther.m_strFormattedValue.clear();
   vrwOther.m_strVarObjParentName.clear();
   vrwOther.m_bChanged = false;
+  vrwOther.m_nHandle = 0;
+  vrwOther.m_nParentHandle = 0;
+  vrwOther.m_vecChildren.clear();
+  vrwOther.m_nChildIndex = 0;
+  vrwOther.m_nLastUse = 0;
+  vrwOther.m_nFrameThreadId = 0;
+  vrwOther.m_nFrameCfa = 0;
 }
 
 //++
@@ -330,72 +379,376 @@ CMIUtilString CMICmnLLDBDebugSessionInfoVarObj::GetStringFormatted(
 // Throws:  None.
 //--
 void CMICmnLLDBDebugSessionInfoVarObj::VarObjClear() {
-  ms_mapVarIdToVarObj.clear();
+  ms_dequeVarObjSlots.clear();
+  ms_vecSlotGeneration.clear();
+  ms_vecSlotFree.clear();
+  ms_mapNameToHandle.clear();
+  ms_mapRootUseToHandle.clear();
+  ms_nUseCount = 0;
+  ms_nEvicted = 0;
+}
+
+//++
+// Details: Add a var object to the internal container. A var object with the
+//          same name is replaced, the replacement keeps its handle, and its
+//          children when it has the same expression and kind, otherwise they
+//          are deleted. If the store is then over its limit root objects used
+//          least recently, other than the one *this object is under, are
+//          deleted.
+// Type:    Static method.
+// Args:    vrwVarObj   - (RW) The var value object, moved into the container.
+// Returns: CMICmnLLDBDebugSessionInfoVarObj & - The var object in the
+//          container.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj &CMICmnLLDBDebugSessionInfoVarObj::VarObjAdd(
+    CMICmnLLDBDebugSessionInfoVarObj &&vrwVarObj) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj = VarObjGet(vrwVarObj.GetName());
+  if (pVarObj != nullptr) {
+    VarObjUnlinkParent(*pVarObj);
+    const VarObjHandle_t nHandle = pVarObj->m_nHandle;
+    // Children are only those of the replacement if it is the same
+    // expression of the same kind
+    if ((pVarObj->m_strNameReal != vrwVarObj.m_strNameReal) ||
+        (pVarObj->m_eValObjKind != vrwVarObj.m_eValObjKind))
+      VarObjDeleteTree(nHandle, true);
+    VecVarObjHandle_t vecChildren(std::move(pVarObj->m_vecChildren));
+    *pVarObj = std::move(vrwVarObj);
+    pVarObj->m_nHandle = nHandle;
+    pVarObj->m_vecChildren = std::move(vecChildren);
+    VarObjLinkParent(*pVarObj);
+    VarObjTouch(*pVarObj);
+    VarObjEvict(VarObjGetRoot(*pVarObj).m_nHandle);
+    return *pVarObj;
+  }
+
+  MIuint nSlot = 0;
+  if (!ms_vecSlotFree.empty()) {
+    nSlot = ms_vecSlotFree.back();
+    ms_vecSlotFree.pop_back();
+    ms_dequeVarObjSlots[nSlot] = std::move(vrwVarObj);
+  } else {
+    nSlot = static_cast<MIuint>(ms_dequeVarObjSlots.size());
+    ms_dequeVarObjSlots.push_back(std::move(vrwVarObj));
+    ms_vecSlotGeneration.push_back(1);
+  }
+
+  CMICmnLLDBDebugSessionInfoVarObj &rVarObj = ms_dequeVarObjSlots[nSlot];
+  rVarObj.m_nHandle =
+      (static_cast<VarObjHandle_t>(ms_vecSlotGeneration[nSlot]) << 32) | nSlot;
+  rVarObj.m_vecChildren.clear();
+  ms_mapNameToHandle[rVarObj.GetName()] = rVarObj.m_nHandle;
+  VarObjLinkParent(rVarObj);
+  VarObjTouch(rVarObj);
+  VarObjEvict(VarObjGetRoot(rVarObj).m_nHandle);
+
+  return rVarObj;
 }
 
 //++
-// Details: Add a var object to the internal container.
+// Details: Delete the var object from the internal container matching the
+//          specified name, along with its children and their children.
 // Type:    Static method.
-// Args:    vrVarObj    - (R) The var value object.
-// Returns: None.
+// Args:    vrVarName       - (R) The var value name.
+//          vbChildrenOnly  - (R) True = delete only the children, false =
+//                            delete the object too.
+// Returns: MIuint - Number of var objects deleted.
 // Throws:  None.
 //--
-void CMICmnLLDBDebugSessionInfoVarObj::VarObjAdd(
-    const CMICmnLLDBDebugSessionInfoVarObj &vrVarObj) {
-  VarObjDelete(vrVarObj.GetName());
-  MapPairKeyToVarObj_t pr(vrVarObj.GetName(), vrVarObj);
-  ms_mapVarIdToVarObj.insert(pr);
+MIuint CMICmnLLDBDebugSessionInfoVarObj::VarObjDelete(
+    const CMIUtilString &vrVarName, const bool vbChildrenOnly) {
+  return VarObjDeleteTree(VarObjFind(vrVarName), vbChildrenOnly);
 }
 
 //++
-// Details: Delete the var object from the internal container matching the
-// specified name.
+// Details: Retrieve the handle of the var object matching the specified name.
+// Type:    Static method.
+// Args:    vrVarName   - (R) The var value name.
+// Returns: VarObjHandle_t - Handle, 0 = object not found.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj::VarObjHandle_t
+CMICmnLLDBDebugSessionInfoVarObj::VarObjFind(const CMIUtilString &vrVarName) {
+  const MapNameToHandle_t::const_iterator it =
+      ms_mapNameToHandle.find(vrVarName);
+  return (it != ms_mapNameToHandle.end()) ? it->second : 0;
+}
+
+//++
+// Details: Retrieve the var object with the specified handle. The object can
+//          be changed in place, it stays where it is until it is deleted.
+// Type:    Static method.
+// Args:    vnHandle    - (R) The var object's handle.
+// Returns: CMICmnLLDBDebugSessionInfoVarObj * - The var object, nullptr = the
+//          handle is 0 or the object has been deleted.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj *
+CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(const VarObjHandle_t vnHandle) {
+  const MIuint nSlot = static_cast<MIuint>(vnHandle);
+  const MIuint nGeneration = static_cast<MIuint>(vnHandle >> 32);
+  if ((nSlot >= ms_vecSlotGeneration.size()) ||
+      (ms_vecSlotGeneration[nSlot] != nGeneration))
+    return nullptr;
+
+  return &ms_dequeVarObjSlots[nSlot];
+}
+
+//++
+// Details: Retrieve the var object matching the specified name. The object
+//          can be changed in place, it stays where it is until it is deleted.
+//          The object is taken as being used, see VarObjSetLimit().
 // Type:    Static method.
 // Args:    vrVarName   - (R) The var value name.
+// Returns: CMICmnLLDBDebugSessionInfoVarObj * - The var object, nullptr =
+//          object not found.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj *
+CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(const CMIUtilString &vrVarName) {
+  const MapNameToHandle_t::const_iterator it =
+      ms_mapNameToHandle.find(vrVarName);
+  if (it == ms_mapNameToHandle.end())
+    return nullptr;
+
+  CMICmnLLDBDebugSessionInfoVarObj &rVarObj =
+      ms_dequeVarObjSlots[static_cast<MIuint>(it->second)];
+  VarObjTouch(rVarObj);
+  return &rVarObj;
+}
+
+//++
+// Details: Add a var object in the container to its parent's children, the
+//          parent being found by the var object's parent name.
+// Type:    Static method.
+// Args:    vrwVarObj   - (RW) The var value object.
+// Returns: None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjLinkParent(
+    CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj) {
+  vrwVarObj.m_nParentHandle = 0;
+  if (vrwVarObj.m_strVarObjParentName.empty())
+    return;
+
+  CMICmnLLDBDebugSessionInfoVarObj *pParent =
+      VarObjGet(vrwVarObj.m_strVarObjParentName);
+  if (pParent == nullptr)
+    return;
+
+  vrwVarObj.m_nChildIndex = static_cast<MIuint>(pParent->m_vecChildren.size());
+  pParent->m_vecChildren.push_back(vrwVarObj.m_nHandle);
+  vrwVarObj.m_nParentHandle = pParent->m_nHandle;
+}
+
+//++
+// Details: Remove a var object in the container from its parent's children,
+//          in constant time, or from the root objects if it has no parent.
+// Type:    Static method.
+// Args:    vrwVarObj   - (RW) The var value object.
 // Returns: None.
 // Throws:  None.
 //--
-void CMICmnLLDBDebugSessionInfoVarObj::VarObjDelete(
-    const CMIUtilString &vrVarName) {
-  const MapKeyToVarObj_t::const_iterator it =
-      ms_mapVarIdToVarObj.find(vrVarName);
-  if (it != ms_mapVarIdToVarObj.end()) {
-    ms_mapVarIdToVarObj.erase(it);
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjUnlinkParent(
+    CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj) {
+  if (vrwVarObj.m_nLastUse != 0) {
+    ms_mapRootUseToHandle.erase(vrwVarObj.m_nLastUse);
+    vrwVarObj.m_nLastUse = 0;
   }
+
+  CMICmnLLDBDebugSessionInfoVarObj *pParent =
+      VarObjGet(vrwVarObj.m_nParentHandle);
+  vrwVarObj.m_nParentHandle = 0;
+  if (pParent == nullptr)
+    return;
+
+  // The last child takes the place of the one removed, the order of the
+  // children does not matter. The parent's children are already gone when
+  // the parent's tree is being deleted.
+  VecVarObjHandle_t &rChildren = pParent->m_vecChildren;
+  const MIuint nIndex = vrwVarObj.m_nChildIndex;
+  vrwVarObj.m_nChildIndex = 0;
+  if ((nIndex >= rChildren.size()) ||
+      (rChildren[nIndex] != vrwVarObj.m_nHandle))
+    return;
+  CMICmnLLDBDebugSessionInfoVarObj *pLast = VarObjGet(rChildren.back());
+  if (pLast != nullptr)
+    pLast->m_nChildIndex = nIndex;
+  rChildren[nIndex] = rChildren.back();
+  rChildren.pop_back();
+}
+
+//++
+// Details: Delete a var object in the container along with its children and
+//          their children.
+// Type:    Static method.
+// Args:    vnHandle        - (R) The var object's handle.
+//          vbChildrenOnly  - (R) True = delete only the children, false =
+//                            delete the object too.
+// Returns: MIuint - Number of var objects deleted.
+// Throws:  None.
+//--
+MIuint CMICmnLLDBDebugSessionInfoVarObj::VarObjDeleteTree(
+    const VarObjHandle_t vnHandle, const bool vbChildrenOnly) {
+  CMICmnLLDBDebugSessionInfoVarObj *pVarObj = VarObjGet(vnHandle);
+  if (pVarObj == nullptr)
+    return 0;
+
+  // Taken first so the children do not look for themselves in the list
+  const VecVarObjHandle_t vecChildren(std::move(pVarObj->m_vecChildren));
+  pVarObj->m_vecChildren.clear();
+  MIuint nDeleted = 0;
+  for (const VarObjHandle_t nChild : vecChildren)
+    nDeleted += VarObjDeleteTree(nChild, false);
+  if (vbChildrenOnly)
+    return nDeleted;
+
+  const MIuint nSlot = static_cast<MIuint>(vnHandle);
+  ms_mapNameToHandle.erase(pVarObj->GetName());
+  VarObjUnlinkParent(*pVarObj);
+  *pVarObj = CMICmnLLDBDebugSessionInfoVarObj();
+
+  // Handles to the slot given out so far are no longer valid
+  if (++ms_vecSlotGeneration[nSlot] == 0)
+    ms_vecSlotGeneration[nSlot] = 1;
+  ms_vecSlotFree.push_back(nSlot);
+
+  return nDeleted + 1;
 }
 
 //++
-// Details: Update an existing var object in the internal container.
+// Details: Retrieve the root var object a var object in the container is
+//          under, the one found by following the parents.
 // Type:    Static method.
 // Args:    vrVarObj    - (R) The var value object.
+// Returns: CMICmnLLDBDebugSessionInfoVarObj & - The root object, vrVarObj if
+//          it has no parent.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj &
+CMICmnLLDBDebugSessionInfoVarObj::VarObjGetRoot(
+    CMICmnLLDBDebugSessionInfoVarObj &vrVarObj) {
+  CMICmnLLDBDebugSessionInfoVarObj *pRoot = &vrVarObj;
+  CMICmnLLDBDebugSessionInfoVarObj *pParent = VarObjGet(pRoot->m_nParentHandle);
+  while (pParent != nullptr) {
+    pRoot = pParent;
+    pParent = VarObjGet(pRoot->m_nParentHandle);
+  }
+  return *pRoot;
+}
+
+//++
+// Details: Mark the root var object a var object in the container is under as
+//          the one used most recently.
+// Type:    Static method.
+// Args:    vrwVarObj   - (RW) The var value object.
 // Returns: None.
 // Throws:  None.
 //--
-void CMICmnLLDBDebugSessionInfoVarObj::VarObjUpdate(
-    const CMICmnLLDBDebugSessionInfoVarObj &vrVarObj) {
-  VarObjAdd(vrVarObj);
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjTouch(
+    CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj) {
+  CMICmnLLDBDebugSessionInfoVarObj &rRoot = VarObjGetRoot(vrwVarObj);
+  if (rRoot.m_nLastUse != 0)
+    ms_mapRootUseToHandle.erase(rRoot.m_nLastUse);
+  rRoot.m_nLastUse = ++ms_nUseCount;
+  ms_mapRootUseToHandle[rRoot.m_nLastUse] = rRoot.m_nHandle;
 }
 
 //++
-// Details: Retrieve the var object matching the specified name.
+// Details: Delete the root var objects used least recently, with their
+//          children, until the container is within its limit.
 // Type:    Static method.
-// Args:    vrVarName   - (R) The var value name.
-//          vrwVarObj   - (W) A var object.
-// Returns: bool    - True = object found, false = object not found.
+// Args:    vnKeepRoot  - (R) Handle of a root object not to delete, 0 = none.
+// Returns: None.
 // Throws:  None.
 //--
-bool CMICmnLLDBDebugSessionInfoVarObj::VarObjGet(
-    const CMIUtilString &vrVarName,
-    CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj) {
-  const MapKeyToVarObj_t::const_iterator it =
-      ms_mapVarIdToVarObj.find(vrVarName);
-  if (it != ms_mapVarIdToVarObj.end()) {
-    const CMICmnLLDBDebugSessionInfoVarObj &rVarObj = (*it).second;
-    vrwVarObj = rVarObj;
-    return true;
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjEvict(
+    const VarObjHandle_t vnKeepRoot) {
+  if (ms_nLimit == 0)
+    return;
+
+  while ((ms_mapNameToHandle.size() > ms_nLimit) &&
+         !ms_mapRootUseToHandle.empty()) {
+    const VarObjHandle_t nRoot = ms_mapRootUseToHandle.begin()->second;
+    if (nRoot == vnKeepRoot)
+      break;
+    ms_nEvicted += VarObjDeleteTree(nRoot, false);
   }
+}
 
-  return false;
+//++
+// Details: Set the most var objects the container is to hold. Once over the
+//          limit the root objects used least recently are deleted, with
+//          their children, so a client that does not delete the var objects
+//          it no longer needs does not make the container grow without end.
+//          A var object is used when it is created, it or one of the objects
+//          under it is named by a command or a child is listed.
+// Type:    Static method.
+// Args:    vnLimit - (R) Number of var objects, 0 = no limit.
+// Returns: None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjSetLimit(const MIuint vnLimit) {
+  ms_nLimit = vnLimit;
+  VarObjEvict(0);
+}
+
+//++
+// Details: Retrieve the most var objects the container is to hold.
+// Type:    Static method.
+// Args:    None.
+// Returns: MIuint - Number of var objects, 0 = no limit.
+// Throws:  None.
+//--
+MIuint CMICmnLLDBDebugSessionInfoVarObj::VarObjGetLimit() { return ms_nLimit; }
+
+//++
+// Details: Retrieve the number of var objects in the container and an
+//          estimate of the memory they take in lldb-mi, the values held by
+//          LLDB are not counted.
+// Type:    Static method.
+// Args:    vrwnCount   - (W) Number of var objects.
+//          vrwnBytes   - (W) Bytes taken by the container.
+//          vrwnEvicted - (W) Number of var objects deleted to keep to the
+//                        limit.
+// Returns: None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjGetCounts(MIuint64 &vrwnCount,
+                                                       MIuint64 &vrwnBytes,
+                                                       MIuint64 &vrwnEvicted) {
+  vrwnCount = ms_mapNameToHandle.size();
+  vrwnBytes =
+      ms_dequeVarObjSlots.size() *
+          (sizeof(CMICmnLLDBDebugSessionInfoVarObj) + sizeof(MIuint)) +
+      ms_vecSlotFree.capacity() * sizeof(MIuint) +
+      ms_mapRootUseToHandle.size() * sizeof(MapUseToHandle_t::value_type);
+  for (const MapNameToHandle_t::value_type &rEntry : ms_mapNameToHandle) {
+    const CMICmnLLDBDebugSessionInfoVarObj &rVarObj =
+        ms_dequeVarObjSlots[static_cast<MIuint>(rEntry.second)];
+    vrwnBytes += sizeof(rEntry) + rEntry.first.capacity() +
+                 rVarObj.m_strName.capacity() +
+                 rVarObj.m_strNameReal.capacity() +
+                 rVarObj.m_strFormattedValue.capacity() +
+                 rVarObj.m_strVarObjParentName.capacity() +
+                 rVarObj.m_vecChildren.capacity() * sizeof(VarObjHandle_t);
+  }
+  vrwnEvicted = ms_nEvicted;
+}
+
+//++
+// Details: Retrieve the handles of the root var objects, those with no parent.
+// Type:    Static method.
+// Args:    vrwRoots    - (W) Handles.
+// Returns: None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugSessionInfoVarObj::VarObjGetRoots(
+    VecVarObjHandle_t &vrwRoots) {
+  vrwRoots.clear();
+  vrwRoots.reserve(ms_mapRootUseToHandle.size());
+  for (const MapUseToHandle_t::value_type &rEntry : ms_mapRootUseToHandle)
+    vrwRoots.push_back(rEntry.second);
 }
 
 //++
@@ -538,8 +891,6 @@ void CMICmnLLDBDebugSessionInfoVarObj::UpdateValue() {
   if (CMICmnLLDBProxySBValue::GetValueAsUnsigned(m_SBValue, nValue) ==
       MIstatus::failure)
     m_eVarType = eVarType_Composite;
-
-  CMICmnLLDBDebugSessionInfoVarObj::VarObjUpdate(*this);
 }
 
 //++
@@ -583,6 +934,68 @@ CMICmnLLDBDebugSessionInfoVarObj::GetVarParentName() const {
   return m_strVarObjParentName;
 }
 
+//++
+// Details: Retrieve the handle of *this var object in the container.
+// Type:    Method.
+// Args:    None.
+// Returns: VarObjHandle_t - Handle, 0 = *this object is not in the container.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj::VarObjHandle_t
+CMICmnLLDBDebugSessionInfoVarObj::GetHandle() const {
+  return m_nHandle;
+}
+
+//++
+// Details: Retrieve the handle of the parent var object, the parent's handle
+//          may be of an object since deleted.
+// Type:    Method.
+// Args:    None.
+// Returns: VarObjHandle_t - Handle, 0 = no parent.
+// Throws:  None.
+//--
+CMICmnLLDBDebugSessionInfoVarObj::VarObjHandle_t
+CMICmnLLDBDebugSessionInfoVarObj::GetParentHandle() const {
+  return m_nParentHandle;
+}
+
+//++
+// Details: Retrieve the handles of the child var objects, those var objects
+//          in the container that were given *this object's name as parent.
+// Type:    Method.
+// Args:    None.
+// Returns: VecVarObjHandle_t & - Handles.
+// Throws:  None.
+//--
+const CMICmnLLDBDebugSessionInfoVarObj::VecVarObjHandle_t &
+CMICmnLLDBDebugSessionInfoVarObj::GetChildren() const {
+  return m_vecChildren;
+}
+
+//++
+// Details: Retrieve the index ID of the thread of the frame the value of a
+//          root var object was created in.
+// Type:    Method.
+// Args:    None.
+// Returns: MIuint - Thread index ID, 0 = not created in a frame.
+// Throws:  None.
+//--
+MIuint CMICmnLLDBDebugSessionInfoVarObj::GetFrameThreadId() const {
+  return m_nFrameThreadId;
+}
+
+//++
+// Details: Retrieve the canonical frame address of the frame the value of a
+//          root var object was created in.
+// Type:    Method.
+// Args:    None.
+// Returns: lldb::addr_t - CFA, 0 = not created in a frame.
+// Throws:  None.
+//--
+lldb::addr_t CMICmnLLDBDebugSessionInfoVarObj::GetFrameCfa() const {
+  return m_nFrameCfa;
+}
+
 //++
 // Details: Retrieve the kind of the value object.
 // Type:    Method.
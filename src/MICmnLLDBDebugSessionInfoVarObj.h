@@ -10,7 +10,11 @@
 
 // Third Party Headers:
 #include "lldb/API/SBValue.h"
+#include <deque>
 #include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // In-house headers:
 #include "MIUtilString.h"
@@ -18,7 +22,15 @@
 //++
 //============================================================================
 // Details: MI debug session variable object. The static functionality in *this
-//          class manages a map container of *these variable objects.
+//          class manages a store of *these variable objects. Each object
+//          added to the store is given a handle, the handle stays valid until
+//          the object is deleted and is then never given out again. Objects
+//          in the store are changed in place, a name index finds an object's
+//          handle and each object knows the handles of its parent and
+//          children.
+//          The store can be given a limit on the number of objects it holds,
+//          once over it the root objects used least recently are deleted
+//          along with their children.
 //--
 class CMICmnLLDBDebugSessionInfoVarObj {
   // Enums:
@@ -59,22 +71,37 @@ public:
     eValObjKind_ConstResult
   };
 
+  // Typedefs:
+public:
+  typedef MIuint64 VarObjHandle_t; // Generation << 32 | slot, 0 = no object
+  typedef std::vector<VarObjHandle_t> VecVarObjHandle_t;
+
   // Statics:
 public:
   static varFormat_e GetVarFormatForString(const CMIUtilString &vrStrFormat);
   static varFormat_e GetVarFormatForChar(char vcFormat);
   static CMIUtilString GetValueStringFormatted(const lldb::SBValue &vrValue,
                                                const varFormat_e veVarFormat);
-  static void VarObjAdd(const CMICmnLLDBDebugSessionInfoVarObj &vrVarObj);
-  static void VarObjDelete(const CMIUtilString &vrVarName);
-  static bool VarObjGet(const CMIUtilString &vrVarName,
-                        CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj);
-  static void VarObjUpdate(const CMICmnLLDBDebugSessionInfoVarObj &vrVarObj);
+  static CMICmnLLDBDebugSessionInfoVarObj &
+  VarObjAdd(CMICmnLLDBDebugSessionInfoVarObj &&vrwVarObj);
+  static MIuint VarObjDelete(const CMIUtilString &vrVarName,
+                             const bool vbChildrenOnly = false);
+  static VarObjHandle_t VarObjFind(const CMIUtilString &vrVarName);
+  static CMICmnLLDBDebugSessionInfoVarObj *
+  VarObjGet(const VarObjHandle_t vnHandle);
+  static CMICmnLLDBDebugSessionInfoVarObj *
+  VarObjGet(const CMIUtilString &vrVarName);
   static void VarObjIdInc();
   static MIuint VarObjIdGet();
   static void VarObjIdResetToZero();
   static void VarObjClear();
   static void VarObjSetFormat(varFormat_e eDefaultFormat);
+  static void VarObjSetLimit(const MIuint vnLimit);
+  static MIuint VarObjGetLimit();
+  static void VarObjGetCounts(MIuint64 &vrwnCount, MIuint64 &vrwnBytes,
+                              MIuint64 &vrwnEvicted);
+  static void VarObjGetRoots(VecVarObjHandle_t &vrwRoots);
+  static void VarObjTouch(CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj);
 
   // Methods:
 public:
@@ -105,6 +132,11 @@ public:
   bool SetVarFormat(const varFormat_e veVarFormat);
   const CMIUtilString &GetVarParentName() const;
   valObjKind_ec GetValObjKind() const;
+  VarObjHandle_t GetHandle() const;
+  VarObjHandle_t GetParentHandle() const;
+  const VecVarObjHandle_t &GetChildren() const;
+  MIuint GetFrameThreadId() const;
+  lldb::addr_t GetFrameCfa() const;
   void UpdateValue();
   bool ExchangeChanged(const bool bChanged);
 
@@ -115,10 +147,12 @@ public:
 
   // Typedefs:
 private:
-  typedef std::map<CMIUtilString, CMICmnLLDBDebugSessionInfoVarObj>
-      MapKeyToVarObj_t;
-  typedef std::pair<CMIUtilString, CMICmnLLDBDebugSessionInfoVarObj>
-      MapPairKeyToVarObj_t;
+  typedef std::deque<CMICmnLLDBDebugSessionInfoVarObj> DequeVarObj_t;
+  typedef std::vector<MIuint> VecSlot_t;
+  typedef std::unordered_map<CMIUtilString, VarObjHandle_t,
+                             std::hash<std::string>>
+      MapNameToHandle_t;
+  typedef std::map<MIuint64, VarObjHandle_t> MapUseToHandle_t;
 
   // Statics:
 private:
@@ -126,6 +160,13 @@ private:
   GetStringFormatted(const MIuint64 vnValue,
                      const CMIUtilString &vrStrValueNatural,
                      varFormat_e veVarFormat);
+  static void VarObjLinkParent(CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj);
+  static void VarObjUnlinkParent(CMICmnLLDBDebugSessionInfoVarObj &vrwVarObj);
+  static MIuint VarObjDeleteTree(const VarObjHandle_t vnHandle,
+                                 const bool vbChildrenOnly);
+  static CMICmnLLDBDebugSessionInfoVarObj &
+  VarObjGetRoot(CMICmnLLDBDebugSessionInfoVarObj &vrVarObj);
+  static void VarObjEvict(const VarObjHandle_t vnKeepRoot);
 
   // Methods:
 private:
@@ -136,7 +177,16 @@ private:
 private:
   static const char *ms_aVarFormatStrings[];
   static const char *ms_aVarFormatChars[];
-  static MapKeyToVarObj_t ms_mapVarIdToVarObj;
+  static DequeVarObj_t ms_dequeVarObjSlots; // Never shrinks so an object
+                                            // stays where it is
+  static VecSlot_t ms_vecSlotGeneration; // Per slot, bumped on delete
+  static VecSlot_t ms_vecSlotFree;       // Slots of deleted objects
+  static MapNameToHandle_t ms_mapNameToHandle;
+  static MapUseToHandle_t ms_mapRootUseToHandle; // Root objects, least
+                                                 // recently used first
+  static MIuint64 ms_nUseCount;                  // Last use given out
+  static MIuint ms_nLimit;      // Most objects kept, 0 = no limit
+  static MIuint64 ms_nEvicted;  // Objects deleted to keep to the limit
   static MIuint ms_nVarUniqueId;
   static varFormat_e ms_eDefaultFormat; // overrides "natural" format
   //
@@ -150,6 +200,15 @@ private:
   CMIUtilString m_strFormattedValue;
   CMIUtilString m_strVarObjParentName;
   bool m_bChanged;
+  VarObjHandle_t m_nHandle;        // Handle of *this object in the store
+  VarObjHandle_t m_nParentHandle;  // Handle of the parent var object
+  VecVarObjHandle_t m_vecChildren; // Handles of the child var objects
+  MIuint m_nChildIndex; // Where *this object is in its parent's children
+  MIuint64 m_nLastUse; // Root objects only, when last used, 0 = not a root
+  MIuint m_nFrameThreadId;  // Root objects only, thread of the frame the
+                            // value was created in
+  lldb::addr_t m_nFrameCfa; // Root objects only, CFA of the frame the value
+                            // was created in, 0 = not created in a frame
   // *** Update the copy move constructors and assignment operator ***
 };
 
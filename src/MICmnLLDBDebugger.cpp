@@ -17,6 +17,7 @@
 #include "lldb/API/SBTypeNameSpecifier.h"
 #include "lldb/API/SBTypeSummary.h"
 #include <cassert>
+#include <chrono>
 
 // In-house headers:
 #include "MICmnLLDBDebugSessionInfo.h"
@@ -24,6 +25,7 @@
 #include "MICmnLLDBDebuggerHandleEvents.h"
 #include "MICmnLog.h"
 #include "MICmnResources.h"
+#include "MICmnStreamStdout.h"
 #include "MICmnThreadMgrStd.h"
 #include "MIDriverBase.h"
 #include "MIUtilSingletonHelper.h"
@@ -71,6 +73,9 @@ static inline bool MI_add_summary(lldb::SBTypeCategory category,
 #endif
 }
 
+// Instantiations:
+const MIuint CMICmnLLDBDebugger::ms_nEventWaitTimeoutSecs = 1;
+
 //++
 // Details: CMICmnLLDBDebugger constructor.
 // Type:    Method.
@@ -79,7 +84,9 @@ static inline bool MI_add_summary(lldb::SBTypeCategory category,
 // Throws:  None.
 //--
 CMICmnLLDBDebugger::CMICmnLLDBDebugger()
-    : m_constStrThisThreadId("MI debugger event") {}
+    : m_lldbWakeUpBroadcaster("lldb-mi.wakeup"),
+      m_constStrThisThreadId("MI debugger event"), m_nSyncsSent(0),
+      m_nSyncsHandled(0) {}
 
 //++
 // Details: CMICmnLLDBDebugger destructor.
@@ -263,11 +270,13 @@ CMIDriverBase &CMICmnLLDBDebugger::GetDriver() const {
 // Details: Wait until all events have been handled.
 //          This function works in pair with
 //          CMICmnLLDBDebugger::MonitorSBListenerEvents
-//          that handles events from queue. When all events were handled and
-//          queue is
-//          empty the MonitorSBListenerEvents notifies this function that it's
-//          ready to
-//          go on. To synchronize them the m_mutexEventQueue and
+//          that handles events from queue. The listener thread takes an event
+//          off the queue before it can say it is handling it, so an empty
+//          queue does not mean all events were handled. Instead a sync event
+//          is queued behind any pending ones and this function waits until
+//          the listener thread reaches it. Events are handled in the order
+//          queued so by then all events queued before it have been handled.
+//          To synchronize them the m_mutexEventQueue and
 //          m_conditionEventQueueEmpty are used.
 // Type:    Method.
 // Args:    None.
@@ -276,10 +285,16 @@ CMIDriverBase &CMICmnLLDBDebugger::GetDriver() const {
 //--
 void CMICmnLLDBDebugger::WaitForHandleEvent() {
   std::unique_lock<std::mutex> lock(m_mutexEventQueue);
+  if (!ThreadIsActive())
+    return;
 
-  lldb::SBEvent event;
-  if (ThreadIsActive() && m_lldbListener.PeekAtNextEvent(event))
-    m_conditionEventQueueEmpty.wait(lock);
+  const MIuint64 nSync = ++m_nSyncsSent;
+  m_lldbWakeUpBroadcaster.BroadcastEventByType(eBroadcastBitSync);
+
+  // Look again now and then in case the listener thread has gone
+  const std::chrono::seconds timeout(ms_nEventWaitTimeoutSecs);
+  while (m_nSyncsHandled < nSync && ThreadIsActive())
+    m_conditionEventQueueEmpty.wait_for(lock, timeout);
 }
 
 //++
@@ -424,6 +439,9 @@ bool CMICmnLLDBDebugger::InitSBListener() {
             strDbgId, m_lldbDebugger.GetCommandInterpreter().GetBroadcaster(),
             eventMask);
 
+  eventMask = eBroadcastBitWakeUp | eBroadcastBitSync;
+  bOk = bOk && RegisterForEvent(strDbgId, m_lldbWakeUpBroadcaster, eventMask);
+
   return bOk;
 }
 
@@ -771,23 +789,28 @@ bool CMICmnLLDBDebugger::ClientGetTheirMask(
 bool CMICmnLLDBDebugger::MonitorSBListenerEvents(bool &vrbIsAlive) {
   vrbIsAlive = true;
 
+  // Block until an event arrives. ThreadKill() wakes us up, the time out only
+  // guards against that wake up being missed. WaitForHandleEvent() does not
+  // rely on the queue being empty, the event taken here may not be handled
+  // yet.
+  lldb::SBEvent event;
+  const bool bGotEvent =
+      m_lldbListener.WaitForEvent(ms_nEventWaitTimeoutSecs, event);
+
   // Lock the mutex of event queue
-  // Note that it should be locked while we are in
-  // CMICmnLLDBDebugger::MonitorSBListenerEvents to
-  // avoid a race condition with CMICmnLLDBDebugger::WaitForHandleEvent
+  // Note that it should be locked while we are handling the event to avoid a
+  // race condition with CMICmnLLDBDebugger::WaitForHandleEvent
   std::unique_lock<std::mutex> lock(m_mutexEventQueue);
 
-  lldb::SBEvent event;
-  const bool bGotEvent = m_lldbListener.GetNextEvent(event);
-  if (!bGotEvent) {
-    // Notify that we are finished and unlock the mutex of event queue before
-    // sleeping
-    m_conditionEventQueueEmpty.notify_one();
-    lock.unlock();
-
-    // Wait a bit to reduce CPU load
-    const std::chrono::milliseconds time(1);
-    std::this_thread::sleep_for(time);
+  if (!bGotEvent)
+    return MIstatus::success;
+  if (event.BroadcasterMatchesRef(m_lldbWakeUpBroadcaster)) {
+    // Notify WaitForHandleEvent() that the events queued before its sync
+    // event have all been handled
+    if ((event.GetType() & eBroadcastBitSync) != 0) {
+      ++m_nSyncsHandled;
+      m_conditionEventQueueEmpty.notify_all();
+    }
     return MIstatus::success;
   }
   assert(event.IsValid());
@@ -800,6 +823,9 @@ bool CMICmnLLDBDebugger::MonitorSBListenerEvents(bool &vrbIsAlive) {
   bool bHandledEvent = false;
   bool bOk = false;
   {
+    // Write all the records the event produces out in one go
+    CMICmnStreamStdoutBatch batch;
+
     // Lock Mutex before handling events so that we don't disturb a running cmd
     CMIUtilThreadLock lock(
         CMICmnLLDBDebugSessionInfo::Instance().GetSessionMutex());
@@ -842,7 +868,40 @@ bool CMICmnLLDBDebugger::ThreadRun(bool &vrbIsAlive) {
 //          MIstatus::failure - Functionality failed.
 // Throws:  None.
 //--
-bool CMICmnLLDBDebugger::ThreadFinish() { return MIstatus::success; }
+bool CMICmnLLDBDebugger::ThreadFinish() {
+  // Release anyone still waiting on events that will now never be handled
+  std::unique_lock<std::mutex> lock(m_mutexEventQueue);
+  m_conditionEventQueueEmpty.notify_all();
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Ask *this thread to stop and wake it up if it is blocked waiting
+//          for an event.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functionality succeeded.
+//          MIstatus::failure - Functionality failed.
+// Throws:  None.
+//--
+bool CMICmnLLDBDebugger::ThreadKill() {
+  const bool bOk = CMIUtilThreadActiveObjBase::ThreadKill();
+  WakeUpListener();
+  return bOk;
+}
+
+//++
+// Details: Make the listener thread return from waiting on an event even if
+//          no debugger event is pending.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnLLDBDebugger::WakeUpListener() {
+  m_lldbWakeUpBroadcaster.BroadcastEventByType(eBroadcastBitWakeUp);
+}
 
 //++
 // Details: Retrieve *this thread object's name.
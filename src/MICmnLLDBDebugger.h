@@ -9,6 +9,7 @@
 #pragma once
 
 // Third party headers
+#include "lldb/API/SBBroadcaster.h"
 #include "lldb/API/SBDebugger.h"
 #include "lldb/API/SBEvent.h"
 #include "lldb/API/SBListener.h"
@@ -67,6 +68,7 @@ public:
 public:
   // From CMIUtilThreadActiveObjBase
   const CMIUtilString &ThreadGetName() const override;
+  bool ThreadKill() override;
 
   // Overridden:
 protected:
@@ -82,6 +84,10 @@ private:
   typedef std::map<CMIUtilString, MIuint> MapIdToEventMask_t;
   typedef std::pair<CMIUtilString, MIuint> MapPairIdToEventMask_t;
 
+  // Enumerations:
+private:
+  enum { eBroadcastBitWakeUp = (1 << 0), eBroadcastBitSync = (1 << 1) };
+
   // Methods:
 private:
   /* ctor */ CMICmnLLDBDebugger();
@@ -92,6 +98,7 @@ private:
   bool InitSBListener();
   bool InitStdStreams();
   bool MonitorSBListenerEvents(bool &vrbYesExit);
+  void WakeUpListener();
 
   bool BroadcasterGetMask(const CMIUtilString &vBroadcasterClass,
                           MIuint &vEventMask) const;
@@ -125,10 +132,16 @@ private:
                                    // them
   lldb::SBListener m_lldbListener; // API clients can register its own listener
                                    // to debugger events
+  lldb::SBBroadcaster m_lldbWakeUpBroadcaster; // Wakes up the listener thread
+                                               // when it has to stop waiting
   const CMIUtilString m_constStrThisThreadId;
   MapBroadcastClassNameToEventMask_t m_mapBroadcastClassNameToEventMask;
   MapIdToEventMask_t m_mapIdToEventMask;
   std::mutex m_mutexEventQueue;
   std::condition_variable m_conditionEventQueueEmpty;
+  MIuint64 m_nSyncsSent;    // Sync events broadcast by WaitForHandleEvent()
+  MIuint64 m_nSyncsHandled; // Sync events the listener thread has reached
+  static const MIuint ms_nEventWaitTimeoutSecs; // Longest time the listener
+                                                // thread blocks for an event
   uint32_t m_nLastStopId;
 };
@@ -1808,6 +1808,8 @@ bool CMICmnLLDBDebuggerHandleEvents::UpdateSelectedThread() {
 // Throws:  None.
 //--
 bool CMICmnLLDBDebuggerHandleEvents::HandleProcessEventStateRunning() {
+  CMICmnLLDBDebugSessionInfo::Instance().SnapshotInvalidate();
+
   CMICmnMIValueConst miValueConst("all");
   CMICmnMIValueResult miValueResult("thread-id", miValueConst);
   CMICmnMIOutOfBandRecord miOutOfBandRecord(
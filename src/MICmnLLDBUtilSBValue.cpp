@@ -8,6 +8,7 @@
 
 // Third party headers:
 #include "lldb/API/SBTypeSummary.h"
+#include <algorithm>
 #include <cinttypes>
 
 // In-house headers:
@@ -15,6 +16,7 @@
 #include "MICmnLLDBUtilSBValue.h"
 #include "MICmnMIValueConst.h"
 #include "MICmnMIValueTuple.h"
+#include "MIUtilCStringReader.h"
 #include "MIUtilString.h"
 
 static const char *kUnknownValue = "??";
@@ -374,10 +376,13 @@ bool CMICmnLLDBUtilSBValue::IsArrayType() const {
 
 //++
 // Details: Retrieve the C string data of value object by read the memory where
-// the
-//          variable is held.
+//          the variable is held. CMIUtilCStringReader reads the memory up to
+//          the end of a page at a time rather than a character at a time, so
+//          a string is one read or a few for a remote target, and stops at
+//          the null character or the maximum length.
 // Type:    Method.
 // Args:    vrValue         - (R) LLDB SBValue variable object.
+//          vnMaxLen        - (R) Most characters to read.
 // Return:  CMIUtilString   - Text description of the variable's value.
 // Throws:  None.
 //--
@@ -386,22 +391,17 @@ CMIUtilString
 CMICmnLLDBUtilSBValue::ReadCStringFromHostMemory(lldb::SBValue &vrValue,
                                                  const MIuint vnMaxLen) const {
   std::string result;
-  lldb::addr_t addr = vrValue.GetLoadAddress(),
-               end_addr = addr + vnMaxLen * sizeof(charT);
   lldb::SBProcess process = CMICmnLLDBDebugSessionInfo::Instance().GetProcess();
   lldb::SBError error;
-  while (addr < end_addr) {
-    charT ch;
-    const MIuint64 nReadBytes =
-        process.ReadMemory(addr, &ch, sizeof(ch), error);
-    if (error.Fail() || nReadBytes != sizeof(ch))
-      return kUnknownValue;
-    else if (ch == 0)
-      break;
-    result.append(
-        CMIUtilString::ConvertToPrintableASCII(ch, true /* bEscapeQuotes */));
-    addr += sizeof(ch);
-  }
+  const auto readFn = [&process, &error](const MIuint64 vnAddr, void *vpBuf,
+                                         const size_t vnBytes) -> size_t {
+    const size_t nReadBytes = process.ReadMemory(vnAddr, vpBuf, vnBytes, error);
+    // A failed read is a short one, the string is unknown unless it ended
+    return error.Success() ? nReadBytes : std::min(nReadBytes, vnBytes - 1);
+  };
+  if (!CMIUtilCStringReader<charT>::Read(vrValue.GetLoadAddress(), vnMaxLen,
+                                         readFn, result))
+    return kUnknownValue;
 
   return result;
 }
@@ -8,6 +8,7 @@
 
 // In-house headers:
 #include "MICmnMIValue.h"
+#include "MICmnMIValueArena.h"
 #include "MICmnResources.h"
 
 //++
@@ -17,17 +18,33 @@
 // Return:  None.
 // Throws:  None.
 //--
-CMICmnMIValue::CMICmnMIValue()
-    : m_strValue(MIRSRC(IDS_WORD_INVALIDBRKTS)), m_bJustConstructed(true) {}
+CMICmnMIValue::CMICmnMIValue() : m_bJustConstructed(true) {
+  CMICmnMIValueArena::Acquire(m_strValue);
+  m_strValue = MIRSRC(IDS_WORD_INVALIDBRKTS);
+}
 
 //++
-// Details: CMICmnMIValue destructor.
+// Details: CMICmnMIValue copy constructor.
+// Type:    Method.
+// Args:    vrValue - (R) Value to copy.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmnMIValue::CMICmnMIValue(const CMICmnMIValue &vrValue)
+    : CMICmnBase(vrValue), m_bJustConstructed(vrValue.m_bJustConstructed) {
+  CMICmnMIValueArena::Acquire(m_strValue);
+  m_strValue = vrValue.m_strValue;
+}
+
+//++
+// Details: CMICmnMIValue destructor. The text buffer goes back to the current
+//          value arena, if any.
 // Type:    Overrideable.
 // Args:    None.
 // Return:  None.
 // Throws:  None.
 //--
-CMICmnMIValue::~CMICmnMIValue() {}
+CMICmnMIValue::~CMICmnMIValue() { CMICmnMIValueArena::Release(m_strValue); }
 
 //++
 // Details: Return the MI value as a string. The string is a direct result of
@@ -34,6 +34,8 @@ class CMICmnMIValue : public CMICmnBase {
   // Methods:
 public:
   /* ctor */ CMICmnMIValue();
+  /* ctor */ CMICmnMIValue(const CMICmnMIValue &vrValue);
+  CMICmnMIValue &operator=(const CMICmnMIValue &vrValue) = default;
   //
   const CMIUtilString &GetString() const;
 
@@ -0,0 +1,118 @@
+//===-- MICmnMIValueArena.cpp -----------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// In-house headers:
+#include "MICmnMIValueArena.h"
+
+// Instantiations:
+const MIuint CMICmnMIValueArena::ms_nSpareMax = 256;
+// Text that fits in the string object itself has no buffer to keep
+const size_t CMICmnMIValueArena::ms_nCapacityMin = CMIUtilString().capacity();
+thread_local CMICmnMIValueArena *CMICmnMIValueArena::ms_pCurrent = nullptr;
+
+//++
+// Details: CMICmnMIValueArena constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmnMIValueArena::CMICmnMIValueArena() : m_nReused(0) {
+  m_vecSpare.reserve(ms_nSpareMax);
+}
+
+//++
+// Details: CMICmnMIValueArena destructor. The spare buffers are freed.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmnMIValueArena::~CMICmnMIValueArena() {
+  if (ms_pCurrent == this)
+    ms_pCurrent = nullptr;
+}
+
+//++
+// Details: Give an empty string a spare buffer from the calling thread's
+//          current arena, if there is one to give.
+// Type:    Static method.
+// Args:    vwrBuffer   - (W) Empty string.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueArena::Acquire(CMIUtilString &vwrBuffer) {
+  CMICmnMIValueArena *pArena = ms_pCurrent;
+  if ((pArena == nullptr) || pArena->m_vecSpare.empty())
+    return;
+
+  vwrBuffer.swap(pArena->m_vecSpare.back());
+  pArena->m_vecSpare.pop_back();
+  ++pArena->m_nReused;
+}
+
+//++
+// Details: Take the buffer of a string that is about to be destroyed into the
+//          calling thread's current arena. The string is left empty.
+// Type:    Static method.
+// Args:    vwrBuffer   - (RW) String no longer needed.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueArena::Release(CMIUtilString &vwrBuffer) {
+  CMICmnMIValueArena *pArena = ms_pCurrent;
+  if ((pArena == nullptr) || (vwrBuffer.capacity() <= ms_nCapacityMin) ||
+      (pArena->m_vecSpare.size() >= ms_nSpareMax))
+    return;
+
+  vwrBuffer.clear();
+  pArena->m_vecSpare.emplace_back();
+  pArena->m_vecSpare.back().swap(vwrBuffer);
+}
+
+//++
+// Details: Retrieve the number of buffers *this arena holds ready for reuse.
+// Type:    Method.
+// Args:    None.
+// Return:  MIuint - Number of buffers.
+// Throws:  None.
+//--
+MIuint CMICmnMIValueArena::GetSpareCount() const {
+  return static_cast<MIuint>(m_vecSpare.size());
+}
+
+//++
+// Details: Retrieve the number of times *this arena gave a buffer for reuse.
+// Type:    Method.
+// Args:    None.
+// Return:  MIuint64 - Number of buffers reused.
+// Throws:  None.
+//--
+MIuint64 CMICmnMIValueArena::GetReuseCount() const { return m_nReused; }
+
+//++
+// Details: CScope constructor. The arena becomes the calling thread's current
+//          arena, the previous one is restored when *this scope ends.
+// Type:    Method.
+// Args:    vpArena - (R) The arena, nullptr = no arena.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmnMIValueArena::CScope::CScope(CMICmnMIValueArena *vpArena)
+    : m_pPrevious(ms_pCurrent) {
+  ms_pCurrent = vpArena;
+}
+
+//++
+// Details: CScope destructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmnMIValueArena::CScope::~CScope() { ms_pCurrent = m_pPrevious; }
@@ -0,0 +1,72 @@
+//===-- MICmnMIValueArena.h -------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <vector>
+
+// In-house headers:
+#include "MIDataTypes.h"
+#include "MIUtilString.h"
+
+//++
+//============================================================================
+// Details: MI common code MI value arena. Keeps the text buffers of MI value
+//          and record objects that have been destroyed so the objects formed
+//          after them reuse the buffers rather than allocating their own.
+//          A command forms and drops many short lived values, with an arena
+//          the heap is only asked for about as many buffers as the command
+//          has values alive at one time.
+//          The CMICmdInvoker gives each command an arena and makes it the
+//          thread's current arena while the command does its work. Objects
+//          formed without a current arena use the heap as before. Buffers are
+//          freed when the arena is deleted, with the command.
+//--
+class CMICmnMIValueArena {
+  // Classes:
+public:
+  //++
+  // Description: Make an arena the current arena of the calling thread for
+  //              the life of *this object.
+  //--
+  class CScope {
+  public:
+    /* ctor */ CScope(CMICmnMIValueArena *vpArena);
+    /* dtor */ ~CScope();
+
+  private:
+    CMICmnMIValueArena *m_pPrevious;
+  };
+
+  // Statics:
+public:
+  static void Acquire(CMIUtilString &vwrBuffer);
+  static void Release(CMIUtilString &vwrBuffer);
+
+  // Methods:
+public:
+  /* ctor */ CMICmnMIValueArena();
+  /* dtor */ ~CMICmnMIValueArena();
+  //
+  MIuint GetSpareCount() const;
+  MIuint64 GetReuseCount() const;
+
+  // Methods:
+private:
+  /* ctor */ CMICmnMIValueArena(const CMICmnMIValueArena &);
+  void operator=(const CMICmnMIValueArena &);
+
+  // Attributes:
+private:
+  std::vector<CMIUtilString> m_vecSpare; // Buffers ready to be reused
+  MIuint64 m_nReused; // Number of times a buffer was reused
+  static const MIuint ms_nSpareMax; // Most buffers kept at one time
+  static const size_t ms_nCapacityMin; // Smaller buffers are not worth keeping
+  static thread_local CMICmnMIValueArena *ms_pCurrent;
+};
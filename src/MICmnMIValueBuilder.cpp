@@ -0,0 +1,238 @@
+//===-- MICmnMIValueBuilder.cpp ---------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// In-house headers:
+#include "MICmnMIValueBuilder.h"
+
+//++
+// Details: CMICmnMIValueBuilder constructor. Text is appended to the end of
+//          the buffer. If the buffer is not empty its current text is taken
+//          to be the first element of a result chain.
+// Type:    Method.
+// Args:    vrwBuffer       - (RW) The text buffer to append to.
+//          vbUseSpacing    - (R) True = put space separators into the string,
+//          false = no spaces used.
+// Return:  None.
+// Throws:  None.
+//--
+CMICmnMIValueBuilder::CMICmnMIValueBuilder(CMIUtilString &vrwBuffer,
+                                           const bool vbUseSpacing)
+    : m_rwBuffer(vrwBuffer), m_bUseSpacing(vbUseSpacing),
+      m_bValuePending(false), m_bLevelHasElement(!vrwBuffer.empty()),
+      m_nDepth(0), m_bRootHasElement(false) {}
+
+//++
+// Details: Start a new list "[". Elements added after it belong to the list
+//          until CloseList() is called.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::OpenList() {
+  BeginElement();
+  m_rwBuffer.push_back('[');
+  EnterLevel();
+}
+
+//++
+// Details: Finish the list most recently opened "]".
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::CloseList() {
+  m_rwBuffer.push_back(']');
+  LeaveLevel();
+}
+
+//++
+// Details: Start a new tuple "{". Elements added after it belong to the tuple
+//          until CloseTuple() is called.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::OpenTuple() {
+  BeginElement();
+  m_rwBuffer.push_back('{');
+  EnterLevel();
+}
+
+//++
+// Details: Finish the tuple most recently opened "}".
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::CloseTuple() {
+  m_rwBuffer.push_back('}');
+  LeaveLevel();
+}
+
+//++
+// Details: Reopen the list or tuple that ends the buffer so more elements can
+//          be appended to it. Its closing bracket is removed and must be put
+//          back with CloseList() or CloseTuple().
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed, buffer does not end with
+//          a list or tuple.
+// Throws:  None.
+//--
+bool CMICmnMIValueBuilder::Reopen() {
+  const size_t nLen = m_rwBuffer.size();
+  if (nLen < 2)
+    return MIstatus::failure;
+  const char cClose = m_rwBuffer[nLen - 1];
+  if ((cClose != ']') && (cClose != '}'))
+    return MIstatus::failure;
+
+  m_rwBuffer.pop_back();
+  const char cLast = m_rwBuffer[nLen - 2];
+  m_bValuePending = false;
+  EnterLevel();
+  m_bLevelHasElement = (cLast != '[') && (cLast != '{');
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Add the variable part of a result "variable=". The next element
+//          added forms the result's value.
+// Type:    Method.
+// Args:    vVariable   - (R) MI value's name.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::Result(const CMIUtilString &vVariable) {
+  BeginElement();
+  m_rwBuffer.append(vVariable);
+  m_rwBuffer.append(m_bUseSpacing ? " = " : "=");
+  m_bValuePending = true;
+}
+
+//++
+// Details: Add a c-string constant. The text is stripped from the last '\n'
+//          onwards, same as CMICmnMIValueConst.
+// Type:    Method.
+// Args:    vText       - (R) MI Const c-string value.
+//          vbNoQuotes  - (R) True = do not surround with quotes, false = use
+//          quotes.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::Const(const CMIUtilString &vText,
+                                 const bool vbNoQuotes) {
+  BeginElement();
+  if (vText.empty()) {
+    m_rwBuffer.append("\"\"");
+    return;
+  }
+
+  const size_t nLen = vText.rfind('\n');
+  if (!vbNoQuotes)
+    m_rwBuffer.push_back('"');
+  m_rwBuffer.append(vText, 0, nLen);
+  if (!vbNoQuotes)
+    m_rwBuffer.push_back('"');
+}
+
+//++
+// Details: Add text that is already a formed MI value or result.
+// Type:    Method.
+// Args:    vText   - (R) MI value text.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::Value(const CMIUtilString &vText) {
+  BeginElement();
+  m_rwBuffer.append(vText);
+}
+
+//++
+// Details: Set whether separators and results are formed with spaces.
+// Type:    Method.
+// Args:    vbUseSpacing    - (R) True = put space separators into the string,
+//          false = no spaces used.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::SetUseSpacing(const bool vbUseSpacing) {
+  m_bUseSpacing = vbUseSpacing;
+}
+
+//++
+// Details: Retrieve the buffer *this builder appends to.
+// Type:    Method.
+// Args:    None.
+// Return:  CMIUtilString & - The buffer.
+// Throws:  None.
+//--
+CMIUtilString &CMICmnMIValueBuilder::GetBuffer() { return m_rwBuffer; }
+
+//++
+// Details: Write the separator needed before a new element of the current
+//          level, if any, and count the element.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::BeginElement() {
+  if (m_bValuePending) {
+    m_bValuePending = false;
+    return;
+  }
+
+  if (m_bLevelHasElement)
+    m_rwBuffer.append(m_bUseSpacing ? ", " : ",");
+  m_bLevelHasElement = true;
+}
+
+//++
+// Details: Descend into a newly opened list or tuple.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::EnterLevel() {
+  // The first level is kept in a member so building a single list or tuple
+  // never allocates
+  if (m_nDepth == 0)
+    m_bRootHasElement = m_bLevelHasElement;
+  else
+    m_vecOuterHasElement.push_back(m_bLevelHasElement);
+  ++m_nDepth;
+  m_bLevelHasElement = false;
+}
+
+//++
+// Details: Return to the level enclosing the list or tuple just closed.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnMIValueBuilder::LeaveLevel() {
+  if (m_nDepth == 0)
+    return;
+
+  --m_nDepth;
+  if (m_nDepth == 0)
+    m_bLevelHasElement = m_bRootHasElement;
+  else {
+    m_bLevelHasElement = m_vecOuterHasElement.back();
+    m_vecOuterHasElement.pop_back();
+  }
+}
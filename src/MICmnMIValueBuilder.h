@@ -0,0 +1,67 @@
+//===-- MICmnMIValueBuilder.h -----------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <vector>
+
+// In-house headers:
+#include "MIDataTypes.h"
+#include "MIUtilString.h"
+
+//++
+//============================================================================
+// Details: MI common code MI value builder. Forms MI value text (see
+//          CMICmnMIValue for the syntax) by appending to one caller owned
+//          buffer so each element added costs only the length of the element
+//          rather than the length of everything formed so far.
+//          Lists and tuples are opened and closed explicitly. Separators are
+//          inserted automatically between the elements of a list, a tuple or
+//          a chain of results. A list or tuple that is already closed in the
+//          buffer can be reopened to append more elements to it.
+//          The builder does not own the buffer and must not outlive it.
+//--
+class CMICmnMIValueBuilder {
+  // Methods:
+public:
+  /* ctor */ CMICmnMIValueBuilder(CMIUtilString &vrwBuffer,
+                                  const bool vbUseSpacing = false);
+  //
+  void OpenList();
+  void CloseList();
+  void OpenTuple();
+  void CloseTuple();
+  bool Reopen();
+  void Result(const CMIUtilString &vVariable);
+  void Const(const CMIUtilString &vText, const bool vbNoQuotes = false);
+  void Value(const CMIUtilString &vText);
+  void SetUseSpacing(const bool vbUseSpacing);
+  CMIUtilString &GetBuffer();
+
+  // Methods:
+private:
+  void BeginElement();
+  void EnterLevel();
+  void LeaveLevel();
+
+  // Attributes:
+private:
+  CMIUtilString &m_rwBuffer;
+  bool m_bUseSpacing;      // True = put space separators into the string, false
+                           // = no spaces used
+  bool m_bValuePending;    // True = a result's variable has been added and its
+                           // value is next, false = next element needs a
+                           // separator if the current level is not empty
+  bool m_bLevelHasElement; // True = current list, tuple or result chain has at
+                           // least one element, false = empty
+  MIuint m_nDepth;         // Number of lists and tuples currently open
+  bool m_bRootHasElement;  // m_bLevelHasElement of the outer most level
+  std::vector<bool> m_vecOuterHasElement; // m_bLevelHasElement of the
+                                          // enclosing levels beyond the first
+};
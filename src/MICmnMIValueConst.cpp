@@ -8,9 +8,7 @@
 
 // In-house headers:
 #include "MICmnMIValueConst.h"
-
-// Instantiations:
-const CMIUtilString CMICmnMIValueConst::ms_constStrDblQuote("\"");
+#include "MICmnMIValueBuilder.h"
 
 //++
 // Details: CMICmnMIValueConst constructor.
@@ -20,8 +18,8 @@ const CMIUtilString CMICmnMIValueConst::ms_constStrDblQuote("\"");
 // Throws:  None.
 //--
 CMICmnMIValueConst::CMICmnMIValueConst(const CMIUtilString &vString)
-    : m_strPartConst(vString), m_bNoQuotes(false) {
-  BuildConst();
+    : m_bNoQuotes(false) {
+  BuildConst(vString);
 }
 
 //++
@@ -35,8 +33,8 @@ CMICmnMIValueConst::CMICmnMIValueConst(const CMIUtilString &vString)
 //--
 CMICmnMIValueConst::CMICmnMIValueConst(const CMIUtilString &vString,
                                        const bool vbNoQuotes)
-    : m_strPartConst(vString), m_bNoQuotes(vbNoQuotes) {
-  BuildConst();
+    : m_bNoQuotes(vbNoQuotes) {
+  BuildConst(vString);
 }
 
 //++
@@ -51,27 +49,15 @@ CMICmnMIValueConst::~CMICmnMIValueConst() {}
 //++
 // Details: Build the Value Const data.
 // Type:    Method.
-// Args:    None.
+// Args:    vString - (R) MI Const c-string value.
 // Return:  MIstatus::success - Functional succeeded.
 //          MIstatus::failure - Functional failed.
 // Throws:  None.
 //--
-bool CMICmnMIValueConst::BuildConst() {
-  if (m_strPartConst.length() != 0) {
-    const CMIUtilString strValue(m_strPartConst.StripCREndOfLine());
-    if (m_bNoQuotes) {
-      m_strValue = strValue;
-    } else {
-      const char *pFormat = "%s%s%s";
-      m_strValue =
-          CMIUtilString::Format(pFormat, ms_constStrDblQuote.c_str(),
-                                strValue.c_str(), ms_constStrDblQuote.c_str());
-    }
-  } else {
-    const char *pFormat = "%s%s";
-    m_strValue = CMIUtilString::Format(pFormat, ms_constStrDblQuote.c_str(),
-                                       ms_constStrDblQuote.c_str());
-  }
+bool CMICmnMIValueConst::BuildConst(const CMIUtilString &vString) {
+  m_strValue.clear();
+  CMICmnMIValueBuilder builder(m_strValue);
+  builder.Const(vString, m_bNoQuotes);
 
   return MIstatus::success;
 }
@@ -47,13 +47,10 @@ public:
 
   // Methods:
 private:
-  bool BuildConst();
+  bool BuildConst(const CMIUtilString &vString);
 
   // Attributes:
 private:
-  static const CMIUtilString ms_constStrDblQuote;
-  //
-  CMIUtilString m_strPartConst;
   bool m_bNoQuotes; // True = return string not surrounded with quotes, false =
                     // use quotes
 };
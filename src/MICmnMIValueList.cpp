@@ -8,6 +8,7 @@
 
 // In-house headers:
 #include "MICmnMIValueList.h"
+#include "MICmnMIValueBuilder.h"
 #include "MICmnResources.h"
 
 //++
@@ -68,8 +69,8 @@ CMICmnMIValueList::~CMICmnMIValueList() {}
 // Throws:  None.
 //--
 void CMICmnMIValueList::BuildList() {
-  const char *pFormat = "[%s]";
-  m_strValue = CMIUtilString::Format(pFormat, m_strValue.c_str());
+  m_strValue.insert(m_strValue.begin(), '[');
+  m_strValue.push_back(']');
 }
 
 //++
@@ -111,18 +112,7 @@ void CMICmnMIValueList::Add(const CMICmnMIValue &vValue) { BuildList(vValue); }
 // Throws:  None.
 //--
 void CMICmnMIValueList::BuildList(const CMICmnMIValueResult &vResult) {
-  // Clear out the default "<Invalid>" text
-  if (m_bJustConstructed) {
-    m_bJustConstructed = false;
-    m_strValue = vResult.GetString();
-    BuildList();
-    return;
-  }
-
-  const CMIUtilString data(ExtractContentNoBrackets());
-  const char *pFormat = "[%s,%s]";
-  m_strValue =
-      CMIUtilString::Format(pFormat, data.c_str(), vResult.GetString().c_str());
+  BuildList(static_cast<const CMICmnMIValue &>(vResult));
 }
 
 //++
@@ -139,19 +129,15 @@ void CMICmnMIValueList::BuildList(const CMICmnMIValue &vValue) {
   // Clear out the default "<Invalid>" text
   if (m_bJustConstructed) {
     m_bJustConstructed = false;
-    m_strValue = vValue.GetString();
-    BuildList();
-    return;
+    m_strValue.clear();
   }
 
-  // Remove already present '[' and ']' from the start and end
-  m_strValue = m_strValue.Trim();
-  size_t len = m_strValue.size();
-  if ((len > 1) && (m_strValue[0] == '[') && (m_strValue[len - 1] == ']'))
-    m_strValue = m_strValue.substr(1, len - 2);
-  const char *pFormat = "[%s,%s]";
-  m_strValue = CMIUtilString::Format(pFormat, m_strValue.c_str(),
-                                     vValue.GetString().c_str());
+  // Append in place rather than re-forming the whole list each time
+  CMICmnMIValueBuilder builder(m_strValue);
+  if (!builder.Reopen())
+    builder.OpenList();
+  builder.Value(vValue.GetString());
+  builder.CloseList();
 }
 
 //++
@@ -8,11 +8,9 @@
 
 // In-house headers:
 #include "MICmnMIValueResult.h"
+#include "MICmnMIValueBuilder.h"
 #include "MICmnResources.h"
 
-// Instantiations:
-const CMIUtilString CMICmnMIValueResult::ms_constStrEqual("=");
-
 //++
 // Details: CMICmnMIValueResult constructor.
 // Type:    Method.
@@ -20,7 +18,8 @@ const CMIUtilString CMICmnMIValueResult::ms_constStrEqual("=");
 // Return:  None.
 // Throws:  None.
 //--
-CMICmnMIValueResult::CMICmnMIValueResult() : m_bEmptyConstruction(true) {}
+CMICmnMIValueResult::CMICmnMIValueResult()
+    : m_bEmptyConstruction(true), m_bUseSpacing(false) {}
 
 //++
 // Details: CMICmnMIValueResult constructor.
@@ -32,9 +31,8 @@ CMICmnMIValueResult::CMICmnMIValueResult() : m_bEmptyConstruction(true) {}
 //--
 CMICmnMIValueResult::CMICmnMIValueResult(const CMIUtilString &vrVariable,
                                          const CMICmnMIValue &vrValue)
-    : m_strPartVariable(vrVariable), m_partMIValue(vrValue),
-      m_bEmptyConstruction(false), m_bUseSpacing(false) {
-  BuildResult();
+    : m_bEmptyConstruction(false), m_bUseSpacing(false) {
+  BuildResult(vrVariable, vrValue);
 }
 
 //++
@@ -50,9 +48,8 @@ CMICmnMIValueResult::CMICmnMIValueResult(const CMIUtilString &vrVariable,
 CMICmnMIValueResult::CMICmnMIValueResult(const CMIUtilString &vrVariable,
                                          const CMICmnMIValue &vrValue,
                                          const bool vbUseSpacing)
-    : m_strPartVariable(vrVariable), m_partMIValue(vrValue),
-      m_bEmptyConstruction(false), m_bUseSpacing(vbUseSpacing) {
-  BuildResult();
+    : m_bEmptyConstruction(false), m_bUseSpacing(vbUseSpacing) {
+  BuildResult(vrVariable, vrValue);
 }
 
 //++
@@ -64,20 +61,6 @@ CMICmnMIValueResult::CMICmnMIValueResult(const CMIUtilString &vrVariable,
 //--
 CMICmnMIValueResult::~CMICmnMIValueResult() {}
 
-//++
-// Details: Build the MI value result string.
-// Type:    Method.
-// Args:    None.
-// Return:  None.
-// Throws:  None.
-//--
-void CMICmnMIValueResult::BuildResult() {
-  const char *pFormat = m_bUseSpacing ? "%s %s %s" : "%s%s%s";
-  m_strValue = CMIUtilString::Format(pFormat, m_strPartVariable.c_str(),
-                                     ms_constStrEqual.c_str(),
-                                     m_partMIValue.GetString().c_str());
-}
-
 //++
 // Details: Build the MI value result string.
 // Type:    Method.
@@ -88,10 +71,16 @@ void CMICmnMIValueResult::BuildResult() {
 //--
 void CMICmnMIValueResult::BuildResult(const CMIUtilString &vVariable,
                                       const CMICmnMIValue &vValue) {
-  const char *pFormat = m_bUseSpacing ? "%s, %s %s %s" : "%s,%s%s%s";
-  m_strValue = CMIUtilString::Format(
-      pFormat, m_strValue.c_str(), vVariable.c_str(), ms_constStrEqual.c_str(),
-      vValue.GetString().c_str());
+  // The first result replaces the default "<Invalid>" text, later ones are
+  // appended to it separated by a comma
+  if (m_bJustConstructed) {
+    m_bJustConstructed = false;
+    m_strValue.clear();
+  }
+
+  CMICmnMIValueBuilder builder(m_strValue, m_bUseSpacing);
+  builder.Result(vVariable);
+  builder.Value(vValue.GetString());
 }
 
 //++
@@ -105,12 +94,6 @@ void CMICmnMIValueResult::BuildResult(const CMIUtilString &vVariable,
 //--
 void CMICmnMIValueResult::Add(const CMIUtilString &vrVariable,
                               const CMICmnMIValue &vrValue) {
-  if (!m_bEmptyConstruction)
-    BuildResult(vrVariable, vrValue);
-  else {
-    m_bEmptyConstruction = false;
-    m_strPartVariable = vrVariable;
-    m_partMIValue = vrValue;
-    BuildResult();
-  }
+  m_bEmptyConstruction = false;
+  BuildResult(vrVariable, vrValue);
 }
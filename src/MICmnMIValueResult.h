@@ -50,15 +50,10 @@ public:
 
   // Methods:
 private:
-  void BuildResult();
   void BuildResult(const CMIUtilString &vVariable, const CMICmnMIValue &vValue);
 
   // Attributes:
 private:
-  static const CMIUtilString ms_constStrEqual;
-  //
-  CMIUtilString m_strPartVariable;
-  CMICmnMIValue m_partMIValue;
   bool m_bEmptyConstruction; // True = *this object used constructor with no
                              // parameters, false = constructor with parameters
   bool m_bUseSpacing; // True = put space separators into the string, false = no
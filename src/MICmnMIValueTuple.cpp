@@ -8,6 +8,7 @@
 
 // In-house headers:
 #include "MICmnMIValueTuple.h"
+#include "MICmnMIValueBuilder.h"
 
 //++
 // Details: CMICmnMIValueTuple constructor.
@@ -68,8 +69,8 @@ CMICmnMIValueTuple::~CMICmnMIValueTuple() {}
 // Throws:  None.
 //--
 void CMICmnMIValueTuple::BuildTuple() {
-  const char *pFormat = "{%s}";
-  m_strValue = CMIUtilString::Format(pFormat, m_strValue.c_str());
+  m_strValue.insert(m_strValue.begin(), '{');
+  m_strValue.push_back('}');
 }
 
 //++
@@ -80,24 +81,7 @@ void CMICmnMIValueTuple::BuildTuple() {
 // Throws:  None.
 //--
 void CMICmnMIValueTuple::BuildTuple(const CMICmnMIValueResult &vResult) {
-  // Clear out the default "<Invalid>" text
-  if (m_bJustConstructed) {
-    m_bJustConstructed = false;
-    m_strValue = vResult.GetString();
-    BuildTuple();
-    return;
-  }
-
-  if (m_strValue[0] == '{') {
-    m_strValue = m_strValue.substr(1, m_strValue.size() - 1);
-  }
-  if (m_strValue[m_strValue.size() - 1] == '}') {
-    m_strValue = m_strValue.substr(0, m_strValue.size() - 1);
-  }
-
-  const char *pFormat = m_bSpaceAfterComma ? "{%s, %s}" : "{%s,%s}";
-  m_strValue = CMIUtilString::Format(pFormat, m_strValue.c_str(),
-                                     vResult.GetString().c_str());
+  BuildTuple(vResult.GetString());
 }
 
 //++
@@ -111,14 +95,15 @@ void CMICmnMIValueTuple::BuildTuple(const CMIUtilString &vValue) {
   // Clear out the default "<Invalid>" text
   if (m_bJustConstructed) {
     m_bJustConstructed = false;
-    m_strValue = vValue;
-    BuildTuple();
-    return;
+    m_strValue.clear();
   }
 
-  const CMIUtilString data(ExtractContentNoBrackets());
-  const char *pFormat = m_bSpaceAfterComma ? "{%s, %s}" : "{%s,%s}";
-  m_strValue = CMIUtilString::Format(pFormat, data.c_str(), vValue.c_str());
+  // Append in place rather than re-forming the whole tuple each time
+  CMICmnMIValueBuilder builder(m_strValue, m_bSpaceAfterComma);
+  if (!builder.Reopen())
+    builder.OpenTuple();
+  builder.Value(vValue);
+  builder.CloseTuple();
 }
 
 //++
@@ -446,6 +446,10 @@ const CMICmnResources::SRsrcTextData
         {IDS_CMD_ERR_LLDB_ERR_NOT_WRITE_WHOLEBLK,
          "Command '%s'. LLDB unable to write entire memory block of %u bytes "
          "at address 0x%016" PRIX64},
+        {IDS_CMD_ERR_DATA_CONTENTS_INVALID,
+         "Command '%s'. Contents are not valid %s text"},
+        {IDS_CMD_ERR_DATA_ENCODING_INVALID,
+         "Command '%s'. Unknown encoding '%s', expected hex, base64 or rle"},
         {IDS_CMD_ERR_SET_NEW_DRIVER_STATE, "Command '%s'. Command tried to set "
                                            "new MI Driver running state and "
                                            "failed. %s"},
@@ -476,7 +480,9 @@ const CMICmnResources::SRsrcTextData
         {IDS_CMD_ERR_ATTACH_BAD_ARGS,
          "Command '%s'. Must specify either a PID or a Name"},
         {IDS_CMD_ERR_GDBSET_OPT_NEW_CONSOLE,
-         "new-console' expects \"on\" or \"off\""}};
+         "new-console' expects \"on\" or \"off\""},
+        {IDS_CMD_ERR_GDBSET_OPT_VAROBJ_LIMIT,
+         "'varobj-limit' expects a number of var objects, 0 for no limit"}};
 
 //++
 // Details: CMICmnResources constructor.
@@ -264,6 +264,8 @@ enum {
   IDS_CMD_ERR_STOPPOINT_INFO_OBJ_NOT_FOUND,
   IDS_CMD_ERR_LLDB_ERR_WRITE_MEM_BYTES,
   IDS_CMD_ERR_LLDB_ERR_NOT_WRITE_WHOLEBLK,
+  IDS_CMD_ERR_DATA_CONTENTS_INVALID,
+  IDS_CMD_ERR_DATA_ENCODING_INVALID,
   IDS_CMD_ERR_SET_NEW_DRIVER_STATE,
   IDS_CMD_ERR_INFO_PRINTFN_NOT_FOUND,
   IDS_CMD_ERR_INFO_PRINTFN_FAILED,
@@ -279,7 +281,8 @@ enum {
   IDS_CMD_ERR_EXPR_INVALID,
   IDS_CMD_ERR_ATTACH_FAILED,
   IDS_CMD_ERR_ATTACH_BAD_ARGS,
-  IDS_CMD_ERR_GDBSET_OPT_NEW_CONSOLE
+  IDS_CMD_ERR_GDBSET_OPT_NEW_CONSOLE,
+  IDS_CMD_ERR_GDBSET_OPT_VAROBJ_LIMIT
 };
 
 //++
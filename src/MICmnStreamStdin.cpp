@@ -18,7 +18,6 @@
 #include "MICmnResources.h"
 #include "MICmnStreamStdin.h"
 #include "MICmnStreamStdout.h"
-#include "MIDriver.h"
 #include "MIUtilSingletonHelper.h"
 
 //++
@@ -173,12 +172,16 @@ bool CMICmnStreamStdin::GetEnablePrompt() const { return m_bShowPrompt; }
 // Details: Wait on new line of data from stdin stream (completed by '\n' or
 // '\r').
 // Type:    Method.
-// Args:    vwErrMsg    - (W) Empty string ok or error description.
+// Args:    vwErrMsg        - (W) Empty string ok or error description.
+//          vwbEndOfInput   - (W) True = stdin has been closed, no more lines
+//                                will follow, false = more may follow.
 // Return:  char * - text buffer pointer or NULL on failure.
 // Throws:  None.
 //--
-const char *CMICmnStreamStdin::ReadLine(CMIUtilString &vwErrMsg) {
+const char *CMICmnStreamStdin::ReadLine(CMIUtilString &vwErrMsg,
+                                        bool &vwbEndOfInput) {
   vwErrMsg.clear();
+  vwbEndOfInput = false;
 
   std::getline(std::cin, m_pCmdString);
 
@@ -190,8 +193,7 @@ const char *CMICmnStreamStdin::ReadLine(CMIUtilString &vwErrMsg) {
     if (::GetLastError() == ERROR_OPERATION_ABORTED)
       return nullptr;
 #endif
-    const bool bForceExit = true;
-    CMIDriver::Instance().SetExitApplicationFlag(bForceExit);
+    vwbEndOfInput = true;
   } else if (std::cin.fail()) {
     vwErrMsg = ::strerror(errno);
     return nullptr;
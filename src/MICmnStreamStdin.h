@@ -37,7 +37,7 @@ public:
   bool SetPrompt(const CMIUtilString &vNewPrompt);
   void SetEnablePrompt(const bool vbYes);
   bool GetEnablePrompt() const;
-  const char *ReadLine(CMIUtilString &vwErrMsg);
+  const char *ReadLine(CMIUtilString &vwErrMsg, bool &vwbEndOfInput);
 
   // Methods:
 private:
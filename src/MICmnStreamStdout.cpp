@@ -12,6 +12,12 @@
 #include "MICmnResources.h"
 #include "MIDriver.h"
 
+// Third party headers:
+#include <chrono>
+
+// Instantiations:
+thread_local MIuint CMICmnStreamStdout::ms_nBatchDepth = 0;
+
 //++
 // Details: CMICmnStreamStdout constructor.
 // Type:    Method.
@@ -19,7 +25,8 @@
 // Return:  None.
 // Throws:  None.
 //--
-CMICmnStreamStdout::CMICmnStreamStdout() {}
+CMICmnStreamStdout::CMICmnStreamStdout()
+    : m_nRecordsBuffered(0), m_nRecordsWritten(0), m_nFlushes(0) {}
 
 //++
 // Details: CMICmnStreamStdout destructor.
@@ -76,6 +83,8 @@ bool CMICmnStreamStdout::Shutdown() {
 
   ClrErrorDescription();
 
+  Flush();
+
   m_bInitialized = false;
 
   return MIstatus::success;
@@ -150,18 +159,15 @@ bool CMICmnStreamStdout::WritePriv(const CMIUtilString &vText,
     // Grab the stdout thread lock while we print
     CMIUtilThreadLock _lock(m_mutex);
 
-    // Send this text to stdout
-    const MIint status = ::fputs(vText.c_str(), stdout);
-    if (status == EOF)
-      // Don't call the CMICmnBase::SetErrorDescription() because it will cause
-      // a stack overflow:
-      // CMICmnBase::SetErrorDescription -> CMICmnStreamStdout::Write ->
-      // CMICmnStreamStdout::WritePriv -> CMICmnBase::SetErrorDescription
-      bOk = MIstatus::failure;
-    else {
-      ::fprintf(stdout, "\n");
-      ::fflush(stdout);
-    }
+    // Queue this text behind anything already waiting so the order it was
+    // written in is kept
+    m_strBuffer.append(vText);
+    m_strBuffer.push_back('\n');
+    ++m_nRecordsBuffered;
+
+    // Send it to stdout now unless this thread is batching its output
+    if (ms_nBatchDepth == 0)
+      bOk = FlushPriv();
 
     // Send this text to the log
     if (bOk && vbSendToLog)
@@ -171,6 +177,112 @@ bool CMICmnStreamStdout::WritePriv(const CMIUtilString &vText,
   return bOk;
 }
 
+//++
+// Details: Send all the buffered text to stdout with one write. The caller
+//          must hold the stream's lock. Only writes that send all the text
+//          are counted and timed.
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmnStreamStdout::FlushPriv() {
+  if (m_strBuffer.empty())
+    return MIstatus::success;
+
+  const std::chrono::steady_clock::time_point tmStart =
+      std::chrono::steady_clock::now();
+  const size_t nLen = m_strBuffer.length();
+  const size_t nWritten = ::fwrite(m_strBuffer.c_str(), 1, nLen, stdout);
+  const MIuint64 nRecords = m_nRecordsBuffered;
+  m_strBuffer.clear();
+  m_nRecordsBuffered = 0;
+  if (nWritten != nLen)
+    // Don't call the CMICmnBase::SetErrorDescription() because it will cause
+    // a stack overflow:
+    // CMICmnBase::SetErrorDescription -> CMICmnStreamStdout::Write ->
+    // CMICmnStreamStdout::WritePriv -> CMICmnBase::SetErrorDescription
+    return MIstatus::failure;
+
+  if (::fflush(stdout) == 0) {
+    m_nRecordsWritten += nRecords;
+    ++m_nFlushes;
+    m_histWriteNs.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - tmStart)
+                          .count());
+  }
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Send any text held back by a batch to stdout now.
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmnStreamStdout::Flush() {
+  CMIUtilThreadLock _lock(m_mutex);
+  return FlushPriv();
+}
+
+//++
+// Details: Start holding back the text the current thread writes to stdout.
+//          Batches nest, the text is written out when the outer most batch
+//          is closed with BatchEnd().
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmnStreamStdout::BatchBegin() {
+  ++ms_nBatchDepth;
+  return MIstatus::success;
+}
+
+//++
+// Details: Close a batch opened with BatchBegin(). Closing the outer most
+//          batch writes out all the text held back.
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMICmnStreamStdout::BatchEnd() {
+  if (ms_nBatchDepth == 0)
+    return MIstatus::failure;
+
+  if (--ms_nBatchDepth > 0)
+    return MIstatus::success;
+
+  return Flush();
+}
+
+//++
+// Details: Retrieve the number of texts sent to stdout, the number of writes
+//          it took to send them and how long those writes took. Batching
+//          saves the difference in number.
+// Type:    Method.
+// Args:    vwnRecords  - (W) Number of texts sent to stdout.
+//          vwnWrites   - (W) Number of writes made to stdout.
+//          vwrWriteNs  - (W) Time taken by each write, in nanoseconds.
+// Return:  None.
+// Throws:  None.
+//--
+void CMICmnStreamStdout::GetWriteStats(MIuint64 &vwnRecords,
+                                       MIuint64 &vwnWrites,
+                                       CMIUtilHistogram &vwrWriteNs) const {
+  CMIUtilThreadLock _lock(m_mutex);
+  vwnRecords = m_nRecordsWritten;
+  vwnWrites = m_nFlushes;
+  vwrWriteNs = m_histWriteNs;
+}
+
 //++
 // Details: Lock the availability of the stream stdout. Other users of *this
 // stream will
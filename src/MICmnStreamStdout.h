@@ -10,6 +10,7 @@
 
 // In-house headers:
 #include "MICmnBase.h"
+#include "MIUtilHistogram.h"
 #include "MIUtilSingletonBase.h"
 #include "MIUtilString.h"
 #include "MIUtilThreadBaseStd.h"
@@ -18,6 +19,13 @@
 //============================================================================
 // Details: MI common code class. The MI driver requires this object.
 //          CMICmnStreamStdout sets up and tears downs stdout for the driver.
+//          While a thread has a batch open (BatchBegin()) the text it writes
+//          is held in a buffer and written out with one write when the batch
+//          is closed, so a command or event producing many records costs one
+//          system call rather than one per record. Text from a thread that
+//          has no batch open is written out immediately along with anything
+//          already buffered so records appear in the order they were
+//          written.
 //
 //          Singleton class.
 //--
@@ -40,6 +48,11 @@ public:
   bool Write(const CMIUtilString &vText, const bool vbSendToLog = true);
   bool WriteMIResponse(const CMIUtilString &vText,
                        const bool vbSendToLog = true);
+  bool BatchBegin();
+  bool BatchEnd();
+  bool Flush();
+  void GetWriteStats(MIuint64 &vwnRecords, MIuint64 &vwnWrites,
+                     CMIUtilHistogram &vwrWriteNs) const;
 
   // Methods:
 private:
@@ -50,6 +63,7 @@ private:
   bool WritePriv(const CMIUtilString &vText,
                  const CMIUtilString &vTxtForLogFile,
                  const bool vbSendToLog = true);
+  bool FlushPriv();
 
   // Overridden:
 private:
@@ -58,5 +72,33 @@ private:
 
   // Attributes:
 private:
-  CMIUtilThreadMutex m_mutex; // Mutex object for sync during writing to stream
+  mutable CMIUtilThreadMutex
+      m_mutex; // Mutex object for sync during writing to stream
+  CMIUtilString m_strBuffer;   // Text written but not yet sent to stdout
+  MIuint64 m_nRecordsBuffered; // Number of texts held in m_strBuffer
+  MIuint64 m_nRecordsWritten;  // Number of texts sent to stdout since start up
+  MIuint64 m_nFlushes;         // Number of writes made to stdout since start up
+  CMIUtilHistogram m_histWriteNs; // Time taken by each of those writes
+  static thread_local MIuint ms_nBatchDepth; // Number of batches the current
+                                             // thread has open
+};
+
+//++
+//============================================================================
+// Details: MI common code class. Holds back the text the current thread
+//          writes to stdout while *this object is in scope and then writes it
+//          out all at once.
+//--
+class CMICmnStreamStdoutBatch {
+  // Methods:
+public:
+  /* ctor */ CMICmnStreamStdoutBatch() {
+    CMICmnStreamStdout::Instance().BatchBegin();
+  }
+
+  // Overrideable:
+public:
+  /* dtor */ virtual ~CMICmnStreamStdoutBatch() {
+    CMICmnStreamStdout::Instance().BatchEnd();
+  }
 };
@@ -41,6 +41,8 @@ const CMIUtilString CMIDriver::ms_constMIVersion =
 const CMIUtilString
     CMIDriver::ms_constAppNameShort(MIRSRC(IDS_MI_APPNAME_SHORT));
 const CMIUtilString CMIDriver::ms_constAppNameLong(MIRSRC(IDS_MI_APPNAME_LONG));
+const CMIUtilString CMIDriver::ms_constStrCmdBatchBegin("lldb-mi-batch-begin");
+const CMIUtilString CMIDriver::ms_constStrCmdBatchEnd("lldb-mi-batch-end");
 
 //++
 // Details: CMIDriver constructor.
@@ -51,7 +53,8 @@ const CMIUtilString CMIDriver::ms_constAppNameLong(MIRSRC(IDS_MI_APPNAME_LONG));
 //--
 CMIDriver::CMIDriver()
     : m_bFallThruToOtherDriverEnabled(false), m_bDriverIsExiting(false),
-      m_handleMainThread(nullptr), m_rStdin(CMICmnStreamStdin::Instance()),
+      m_handleMainThread(nullptr),
+      m_rCmdReader(CMIDriverCmdReader::Instance()),
       m_rLldbDebugger(CMICmnLLDBDebugger::Instance()),
       m_rStdOut(CMICmnStreamStdout::Instance()),
       m_eCurrentDriverState(eDriverState_NotRunning),
@@ -163,6 +166,8 @@ bool CMIDriver::Initialize() {
                                      errMsg);
   MI::ModuleInit<CMICmnStreamStdin>(IDS_MI_INIT_ERR_STREAMSTDIN, bOk, errMsg);
   MI::ModuleInit<CMICmdMgr>(IDS_MI_INIT_ERR_CMDMGR, bOk, errMsg);
+  MI::ModuleInit<CMIDriverCmdReader>(IDS_MI_INIT_ERR_OS_STDIN_HANDLER, bOk,
+                                     errMsg);
   bOk &= m_rLldbDebugger.SetDriver(*this);
   MI::ModuleInit<CMICmnLLDBDebugger>(IDS_MI_INIT_ERR_LLDBDEBUGGER, bOk, errMsg);
 
@@ -207,6 +212,8 @@ bool CMIDriver::Shutdown() {
   // Shutdown all of the modules we depend on
   MI::ModuleShutdown<CMICmnLLDBDebugger>(IDS_MI_INIT_ERR_LLDBDEBUGGER, bOk,
                                          errMsg);
+  MI::ModuleShutdown<CMIDriverCmdReader>(IDS_MI_INIT_ERR_OS_STDIN_HANDLER, bOk,
+                                         errMsg);
   MI::ModuleShutdown<CMICmdMgr>(IDS_MI_INIT_ERR_CMDMGR, bOk, errMsg);
   MI::ModuleShutdown<CMICmnStreamStdin>(IDS_MI_INIT_ERR_STREAMSTDIN, bOk,
                                         errMsg);
@@ -507,6 +514,12 @@ bool CMIDriver::StartWorkerThreads() {
     return MIstatus::failure;
   }
 
+  // Start reading and interpreting the client's commands ahead of running them
+  if (bOk && !m_rCmdReader.StartThread(*this)) {
+    SetErrorDescription(m_rCmdReader.GetErrorDescription());
+    return MIstatus::failure;
+  }
+
   return bOk;
 }
 
@@ -519,6 +532,8 @@ bool CMIDriver::StartWorkerThreads() {
 // Throws:  None.
 //--
 bool CMIDriver::StopWorkerThreads() {
+  m_rCmdReader.StopThread();
+
   CMICmnThreadMgrStd &rThreadMgr = CMICmnThreadMgrStd::Instance();
   return rThreadMgr.ThreadAllTerminate();
 }
@@ -568,30 +583,50 @@ bool CMIDriver::DoMainLoop() {
 
   // While the app is active
   while (bOk && !m_bExitApp) {
-    CMIUtilString errorText;
-    const char *pCmd = m_rStdin.ReadLine(errorText);
-    if (pCmd != nullptr) {
-      CMIUtilString lineText(pCmd);
-      if (!lineText.empty()) {
-        // Check that the handler thread is alive (otherwise we stuck here)
-        assert(CMICmnLLDBDebugger::Instance().ThreadIsActive());
-
-        {
-          // Lock Mutex before processing commands so that we don't disturb an
-          // event
-          // being processed
-          CMIUtilThreadLock lock(
-              CMICmnLLDBDebugSessionInfo::Instance().GetSessionMutex());
-          bOk = InterpretCommand(lineText);
-        }
+    // Nothing may be left held back while we wait on the client
+    m_rStdOut.Flush();
+
+    // The reader thread has already read and interpreted the next command,
+    // commands are taken in the order the client sent them
+    CMIDriverCmdReader::SCmd cmd;
+    if (!m_rCmdReader.Pop(cmd))
+      continue;
+    bool bEndOfInput = cmd.bEndOfInput;
+    VecCmd_t vecCmds;
+    if (!bEndOfInput)
+      vecCmds.push_back(cmd);
+    if (!bEndOfInput && (cmd.cmdData.strMiCmd == ms_constStrCmdBatchBegin))
+      PopCmdBatch(vecCmds, bEndOfInput);
+
+    // Check that the handler thread is alive (otherwise we stuck here)
+    assert(CMICmnLLDBDebugger::Instance().ThreadIsActive());
+
+    {
+      // Write the commands' records and the prompts out in one go
+      CMICmnStreamStdoutBatch batch;
+
+      // Lock Mutex before processing commands so that we don't disturb
+      // an event being processed
+      CMIUtilThreadLock lock(
+          CMICmnLLDBDebugSessionInfo::Instance().GetSessionMutex());
+      for (const CMIDriverCmdReader::SCmd &rCmd : vecCmds) {
+        bOk = InterpretCommand(rCmd);
 
         // Draw prompt if desired
         bOk = bOk && CMICmnStreamStdout::WritePrompt();
-
-        // Wait while the handler thread handles incoming events
-        CMICmnLLDBDebugger::Instance().WaitForHandleEvent();
+        if (!bOk || m_bExitApp)
+          break;
       }
     }
+
+    if (bEndOfInput) {
+      const bool bForceExit = true;
+      SetExitApplicationFlag(bForceExit);
+      continue;
+    }
+
+    // Wait while the handler thread handles incoming events
+    CMICmnLLDBDebugger::Instance().WaitForHandleEvent();
   }
 
   // Signal that the application is shutting down
@@ -603,6 +638,36 @@ bool CMIDriver::DoMainLoop() {
   return MIstatus::success;
 }
 
+//++
+// Details: Take the rest of a batch the client opened with
+//          "-lldb-mi-batch-begin" off the command queue, up to and including
+//          "-lldb-mi-batch-end". The batch is run as one: under one lock of
+//          the session mutex, with its records written out together and one
+//          wait for the events it causes to be handled.
+//          This function is used by the application's main thread.
+// Type:    Method.
+// Args:    vwCmds          - (W) Commands to run, the batch is added.
+//          vwbEndOfInput   - (W) True = stdin was closed before the batch was
+//                                ended, false = batch ended.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIDriver::PopCmdBatch(VecCmd_t &vwCmds, bool &vwbEndOfInput) {
+  vwbEndOfInput = false;
+  CMIDriverCmdReader::SCmd cmd;
+  while (!m_bExitApp) {
+    if (!m_rCmdReader.Pop(cmd))
+      continue;
+    if (cmd.bEndOfInput) {
+      vwbEndOfInput = true;
+      return;
+    }
+    vwCmds.push_back(cmd);
+    if (cmd.cmdData.strMiCmd == ms_constStrCmdBatchEnd)
+      return;
+  }
+}
+
 //++
 // Details: Set things in motion, set state etc that brings *this driver (and
 // the
@@ -831,6 +896,30 @@ bool CMIDriver::InterpretCommand(const CMIUtilString &vTextLine) {
   return bOk;
 }
 
+//++
+// Details: Issue a command read and interpreted by the command reader thread,
+//          as InterpretCommand() does for a line of text.
+//          This function is used by the application's main thread.
+// Type:    Method.
+// Args:    vCmd    - (R) The command line and what the interpreter made of it.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMIDriver::InterpretCommand(const CMIDriverCmdReader::SCmd &vCmd) {
+  const bool bNeedToRebroadcastStopEvent =
+      m_rLldbDebugger.CheckIfNeedToRebroadcastStopEvent();
+  bool bCmdYesValid = vCmd.bCmdYesValid;
+  bool bOk = InterpretCommandThisDriver(vCmd);
+  if (bOk && !bCmdYesValid)
+    bOk = InterpretCommandFallThruDriver(vCmd.strMiTextLine, bCmdYesValid);
+
+  if (bNeedToRebroadcastStopEvent)
+    m_rLldbDebugger.RebroadcastStopEvent();
+
+  return bOk;
+}
+
 //++
 // Details: Helper function for CMIDriver::InterpretCommandThisDriver.
 //          Convert a CLI command to MI command (just wrap any CLI command
@@ -906,6 +995,41 @@ CMIDriver::WrapCLICommandIntoMICommand(const CMIUtilString &vTextLine) const {
                                vToken.c_str(), vShieldedCliCommand.c_str());
 }
 
+//++
+// Details: Read the client's next command line from stdin.
+//          This function is used by the command reader's thread.
+// Type:    Overridden.
+// Args:    vwErrMsg        - (W) Empty string ok or error description.
+//          vwbEndOfInput   - (W) True = stdin was closed.
+// Return:  const char * - The line, nullptr = none read.
+// Throws:  None.
+//--
+const char *CMIDriver::ReadCmdLine(CMIUtilString &vwErrMsg,
+                                   bool &vwbEndOfInput) {
+  return CMICmnStreamStdin::Instance().ReadLine(vwErrMsg, vwbEndOfInput);
+}
+
+//++
+// Details: Wrap a CLI command line as an MI command and have the command
+//          interpreter match it against the current commands.
+//          This function is used by the command reader's thread.
+// Type:    Overridden.
+// Args:    vTextLine   - (R) Text data representing a possible command.
+//          vwCmd       - (W) The command line and what the interpreter made
+//                        of it.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIDriver::InterpretCmdLine(const CMIUtilString &vTextLine,
+                                 CMIDriverCmdReader::SCmd &vwCmd) {
+  vwCmd.strMiTextLine = WrapCLICommandIntoMICommand(vTextLine);
+  if (!CMICmdMgr::Instance().CmdInterpret(vwCmd.strMiTextLine,
+                                          vwCmd.bCmdYesValid,
+                                          vwCmd.bCmdNotInCmdFactory,
+                                          vwCmd.cmdData))
+    vwCmd.bCmdYesValid = false;
+}
+
 //++
 // Details: Interpret the text data and match against current commands to see if
 // there
@@ -926,31 +1050,49 @@ CMIDriver::WrapCLICommandIntoMICommand(const CMIUtilString &vTextLine) const {
 bool CMIDriver::InterpretCommandThisDriver(const CMIUtilString &vTextLine,
                                            bool &vwbCmdYesValid) {
   // Convert any CLI commands into MI commands
-  const CMIUtilString vMITextLine(WrapCLICommandIntoMICommand(vTextLine));
+  CMIDriverCmdReader::SCmd cmd;
+  cmd.strMiTextLine = WrapCLICommandIntoMICommand(vTextLine);
 
   vwbCmdYesValid = false;
-  bool bCmdNotInCmdFactor = false;
-  SMICmdData cmdData;
   CMICmdMgr &rCmdMgr = CMICmdMgr::Instance();
-  if (!rCmdMgr.CmdInterpret(vMITextLine, vwbCmdYesValid, bCmdNotInCmdFactor,
-                            cmdData))
+  if (!rCmdMgr.CmdInterpret(cmd.strMiTextLine, cmd.bCmdYesValid,
+                            cmd.bCmdNotInCmdFactory, cmd.cmdData))
     return MIstatus::failure;
 
-  if (vwbCmdYesValid) {
+  vwbCmdYesValid = cmd.bCmdYesValid;
+  return InterpretCommandThisDriver(cmd);
+}
+
+//++
+// Details: Issue a command the command interpreter has already matched
+//          against the current commands. A command that did not match is
+//          reported to the client as not valid.
+//          This function is used by the application's main thread.
+// Type:    Method.
+// Args:    vCmd    - (R) The command line and what the interpreter made of it.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMIDriver::InterpretCommandThisDriver(
+    const CMIDriverCmdReader::SCmd &vCmd) {
+  const CMIUtilString &rMITextLine(vCmd.strMiTextLine);
+  const SMICmdData &rCmdData(vCmd.cmdData);
+  if (vCmd.bCmdYesValid) {
     // For debugging only
-    // m_pLog->WriteLog( cmdData.strMiCmdAll.c_str() );
+    // m_pLog->WriteLog( rCmdData.strMiCmdAll.c_str() );
 
-    return ExecuteCommand(cmdData);
+    return ExecuteCommand(rCmdData);
   }
 
   // Check for escape character, may be cursor control characters
   // This code is not necessary for application operation, just want to keep
   // tabs on what
   // has been given to the driver to try and interpret.
-  if (vMITextLine.at(0) == 27) {
+  if (rMITextLine.at(0) == 27) {
     CMIUtilString logInput(MIRSRC(IDS_STDIN_INPUT_CTRL_CHARS));
-    for (MIuint i = 0; i < vMITextLine.length(); i++) {
-      logInput += CMIUtilString::Format("%d ", vMITextLine.at(i));
+    for (MIuint i = 0; i < rMITextLine.length(); i++) {
+      logInput += CMIUtilString::Format("%d ", rMITextLine.at(i));
     }
     m_pLog->WriteLog(logInput);
     return MIstatus::success;
@@ -959,18 +1101,18 @@ bool CMIDriver::InterpretCommandThisDriver(const CMIUtilString &vTextLine,
   // Write to the Log that a 'command' was not valid.
   // Report back to the MI client via MI result record.
   CMIUtilString strNotInCmdFactory;
-  if (bCmdNotInCmdFactor)
+  if (vCmd.bCmdNotInCmdFactory)
     strNotInCmdFactory = CMIUtilString::Format(
-        MIRSRC(IDS_DRIVER_CMD_NOT_IN_FACTORY), cmdData.strMiCmd.c_str());
+        MIRSRC(IDS_DRIVER_CMD_NOT_IN_FACTORY), rCmdData.strMiCmd.c_str());
   const CMIUtilString strNot(
       CMIUtilString::Format("%s ", MIRSRC(IDS_WORD_NOT)));
   const CMIUtilString msg(CMIUtilString::Format(
-      MIRSRC(IDS_DRIVER_CMD_RECEIVED), vMITextLine.c_str(), strNot.c_str(),
+      MIRSRC(IDS_DRIVER_CMD_RECEIVED), rMITextLine.c_str(), strNot.c_str(),
       strNotInCmdFactory.c_str()));
   const CMICmnMIValueConst vconst = CMICmnMIValueConst(msg);
   const CMICmnMIValueResult valueResult("msg", vconst);
   const CMICmnMIResultRecord miResultRecord(
-      cmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Error,
+      rCmdData.strMiCmdToken, CMICmnMIResultRecord::eResultClass_Error,
       valueResult);
   const bool bOk = m_rStdOut.WriteMIResponse(miResultRecord.GetString());
 
@@ -1009,8 +1151,12 @@ bool CMIDriver::ExecuteCommand(const SMICmdData &vCmdData) {
 //--
 void CMIDriver::SetExitApplicationFlag(const bool vbForceExit) {
   if (vbForceExit) {
-    CMIUtilThreadLock lock(m_threadMutex);
-    m_bExitApp = true;
+    {
+      CMIUtilThreadLock lock(m_threadMutex);
+      m_bExitApp = true;
+    }
+    // The main thread may be waiting on the next command
+    m_rCmdReader.WakeUp();
     return;
   }
 
@@ -1024,6 +1170,7 @@ void CMIDriver::SetExitApplicationFlag(const bool vbForceExit) {
   }
 
   m_bExitApp = true;
+  m_rCmdReader.WakeUp();
 }
 
 //++
@@ -10,6 +10,7 @@
 
 // Third party headers
 #include <queue>
+#include <vector>
 
 // In-house headers:
 #include "MICmdData.h"
@@ -17,6 +18,7 @@
 #include "MICmnConfig.h"
 #include "MICmnStreamStdin.h"
 #include "MIDriverBase.h"
+#include "MIDriverCmdReader.h"
 #include "MIDriverMgr.h"
 #include "MIUtilSingletonBase.h"
 
@@ -36,6 +38,7 @@ class CMICmnStreamStdout;
 class CMIDriver : public CMICmnBase,
                   public CMIDriverMgr::IDriver,
                   public CMIDriverBase,
+                  public CMIDriverCmdReader::IInput,
                   public MI::ISingleton<CMIDriver> {
   friend class MI::ISingleton<CMIDriver>;
 
@@ -88,6 +91,8 @@ public:
   bool GetEnableFallThru() const;
   bool HaveExecutableFileNamePathOnCmdLine() const;
   const CMIUtilString &GetExecutableFileNamePathOnCmdLine() const;
+  CMIUtilString
+  WrapCLICommandIntoMICommand(const CMIUtilString &vTextLine) const;
 
   // Overridden:
 public:
@@ -114,10 +119,16 @@ public:
   const CMIUtilString &GetDriverName() const override;
   const CMIUtilString &GetDriverId() const override;
   void DeliverSignal(int signal) override;
+  // From CMIDriverCmdReader::IInput
+  const char *ReadCmdLine(CMIUtilString &vwErrMsg,
+                          bool &vwbEndOfInput) override;
+  void InterpretCmdLine(const CMIUtilString &vTextLine,
+                        CMIDriverCmdReader::SCmd &vwCmd) override;
 
   // Typedefs:
 private:
   typedef std::queue<CMIUtilString> QueueStdinLine_t;
+  typedef std::vector<CMIDriverCmdReader::SCmd> VecCmd_t;
 
   // Methods:
 private:
@@ -129,10 +140,11 @@ private:
                           bool &vwbExiting);
   bool DoAppQuit();
   bool InterpretCommand(const CMIUtilString &vTextLine);
+  bool InterpretCommand(const CMIDriverCmdReader::SCmd &vCmd);
   bool InterpretCommandThisDriver(const CMIUtilString &vTextLine,
                                   bool &vwbCmdYesValid);
-  CMIUtilString
-  WrapCLICommandIntoMICommand(const CMIUtilString &vTextLine) const;
+  bool InterpretCommandThisDriver(const CMIDriverCmdReader::SCmd &vCmd);
+  void PopCmdBatch(VecCmd_t &vwCmds, bool &vwbEndOfInput);
   bool InterpretCommandFallThruDriver(const CMIUtilString &vTextLine,
                                       bool &vwbCmdYesValid);
   bool ExecuteCommand(const SMICmdData &vCmdData);
@@ -154,6 +166,8 @@ private:
   static const CMIUtilString ms_constAppNameShort;
   static const CMIUtilString ms_constAppNameLong;
   static const CMIUtilString ms_constMIVersion;
+  static const CMIUtilString ms_constStrCmdBatchBegin;
+  static const CMIUtilString ms_constStrCmdBatchEnd;
   //
   bool m_bFallThruToOtherDriverEnabled; // True = yes fall through, false = do
                                         // not pass on command
@@ -161,7 +175,7 @@ private:
   bool m_bDriverIsExiting;  // True = yes, driver told to quit, false = continue
                             // working
   void *m_handleMainThread; // *this driver is run by the main thread
-  CMICmnStreamStdin &m_rStdin;
+  CMIDriverCmdReader &m_rCmdReader;
   CMICmnLLDBDebugger &m_rLldbDebugger;
   CMICmnStreamStdout &m_rStdOut;
   DriverState_e m_eCurrentDriverState;
@@ -0,0 +1,260 @@
+//===-- MIDriverCmdReader.cpp -----------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// In-house headers:
+#include "MIDriverCmdReader.h"
+#include "MICmnResources.h"
+#include "MIUtilSingletonHelper.h"
+
+//++
+// Details: SCmd constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMIDriverCmdReader::SCmd::SCmd()
+    : bCmdYesValid(false), bCmdNotInCmdFactory(false), bEndOfInput(false) {}
+
+//++
+// Details: CMIDriverCmdReader constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMIDriverCmdReader::CMIDriverCmdReader()
+    : m_constStrThisThreadId("MI command reader"), m_pInput(nullptr),
+      m_bWakeUp(false) {}
+
+//++
+// Details: CMIDriverCmdReader destructor.
+// Type:    Overridden.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMIDriverCmdReader::~CMIDriverCmdReader() { Shutdown(); }
+
+//++
+// Details: Initialize resources for *this command reader.
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functionality succeeded.
+//          MIstatus::failure - Functionality failed.
+// Throws:  None.
+//--
+bool CMIDriverCmdReader::Initialize() {
+  m_clientUsageRefCnt++;
+
+  if (m_bInitialized)
+    return MIstatus::success;
+
+  bool bOk = MIstatus::success;
+  CMIUtilString errMsg;
+  ClrErrorDescription();
+
+  MI::ModuleInit<CMICmnResources>(IDS_MI_INIT_ERR_RESOURCES, bOk, errMsg);
+
+  m_bInitialized = bOk;
+
+  if (!bOk) {
+    CMIUtilString strInitError(CMIUtilString::Format(
+        MIRSRC(IDS_MI_INIT_ERR_OS_STDIN_HANDLER), errMsg.c_str()));
+    SetErrorDescription(strInitError);
+    return MIstatus::failure;
+  }
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Release resources for *this command reader.
+// Type:    Method.
+// Args:    None.
+// Return:  MIstatus::success - Functionality succeeded.
+//          MIstatus::failure - Functionality failed.
+// Throws:  None.
+//--
+bool CMIDriverCmdReader::Shutdown() {
+  if (--m_clientUsageRefCnt > 0)
+    return MIstatus::success;
+
+  if (!m_bInitialized)
+    return MIstatus::success;
+
+  m_bInitialized = false;
+
+  ClrErrorDescription();
+
+  bool bOk = MIstatus::success;
+  CMIUtilString errMsg;
+
+  MI::ModuleShutdown<CMICmnResources>(IDS_MI_INIT_ERR_RESOURCES, bOk, errMsg);
+
+  if (!bOk) {
+    SetErrorDescriptionn(MIRSRC(IDS_MI_SHUTDOWN_ERR), errMsg.c_str());
+  }
+
+  return bOk;
+}
+
+//++
+// Details: Start the worker thread reading commands. A thread stopped before
+//          is started again.
+// Type:    Method.
+// Args:    vrInput - (R) Where the commands come from.
+// Return:  MIstatus::success - Functionality succeeded.
+//          MIstatus::failure - Functionality failed.
+// Throws:  None.
+//--
+bool CMIDriverCmdReader::StartThread(IInput &vrInput) {
+  if (ThreadIsActive())
+    return MIstatus::success;
+
+  {
+    CMIUtilThreadLock serial(m_mutex);
+    m_pInput = &vrInput;
+    m_bHasBeenKilled = false;
+  }
+  if (!Acquire() || !ThreadExecute()) {
+    SetErrorDescription(
+        CMIUtilString::Format(MIRSRC(IDS_STDIN_ERR_THREAD_CREATION_FAILED),
+                              m_constStrThisThreadId.c_str()));
+    return MIstatus::failure;
+  }
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Ask the worker thread to stop. A line being interpreted is finished
+//          first, after this no line is interpreted. A thread still blocked
+//          reading stdin cannot be woken so it is left to end with the
+//          application, it stops as soon as its read returns.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIDriverCmdReader::StopThread() {
+  ThreadKill();
+  m_thread.Detach();
+}
+
+//++
+// Details: Take the next command read off the queue, waiting until there is
+//          one or WakeUp() is called.
+//          This function is used by the application's main thread.
+// Type:    Method.
+// Args:    vwCmd   - (W) The command.
+// Return:  bool - True = a command was taken, false = woken up with none.
+// Throws:  None.
+//--
+bool CMIDriverCmdReader::Pop(SCmd &vwCmd) {
+  std::unique_lock<std::mutex> lock(m_mutexQueue);
+  m_conditionQueue.wait(lock,
+                        [this] { return !m_queueCmds.empty() || m_bWakeUp; });
+  m_bWakeUp = false;
+  if (m_queueCmds.empty())
+    return false;
+
+  vwCmd = m_queueCmds.front();
+  m_queueCmds.pop_front();
+  return true;
+}
+
+//++
+// Details: Make the thread waiting in Pop() return even if there is no command
+//          to take, i.e. so the driver can see it has been asked to exit.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIDriverCmdReader::WakeUp() {
+  std::lock_guard<std::mutex> lock(m_mutexQueue);
+  m_bWakeUp = true;
+  m_conditionQueue.notify_all();
+}
+
+//++
+// Details: Add a command read to the end of the queue.
+// Type:    Method.
+// Args:    vCmd    - (R) The command.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIDriverCmdReader::Push(const SCmd &vCmd) {
+  std::lock_guard<std::mutex> lock(m_mutexQueue);
+  m_queueCmds.push_back(vCmd);
+  m_conditionQueue.notify_all();
+}
+
+//++
+// Details: The main worker method for this thread. Read a line of input and
+//          interpret it so the driver can run it without further work. Once
+//          stdin is closed the driver is told there is no more input and the
+//          thread stops.
+// Type:    Overridden.
+// Args:    vrbIsAlive  - (W) True = *this thread is working, false = thread has
+//                        exited.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed.
+// Throws:  None.
+//--
+bool CMIDriverCmdReader::ThreadRun(bool &vrbIsAlive) {
+  CMIUtilString errorText;
+  bool bEndOfInput = false;
+  const char *pLine = m_pInput->ReadCmdLine(errorText, bEndOfInput);
+
+  // The driver may have stopped *this thread while it was reading and be
+  // shutting down the modules used to interpret the line. The lock is held
+  // until the line is queued so StopThread() waits for it.
+  CMIUtilThreadLock serial(m_mutex);
+  if (m_bHasBeenKilled) {
+    vrbIsAlive = false;
+    return MIstatus::success;
+  }
+
+  if ((pLine != nullptr) && (*pLine != '\0')) {
+    SCmd cmd;
+    m_pInput->InterpretCmdLine(pLine, cmd);
+    Push(cmd);
+  }
+
+  if (bEndOfInput) {
+    SCmd cmd;
+    cmd.bEndOfInput = true;
+    Push(cmd);
+    vrbIsAlive = false;
+  }
+
+  return MIstatus::success;
+}
+
+//++
+// Details: Let this thread clean up after itself.
+// Type:    Overridden.
+// Args:    None.
+// Return:  MIstatus::success - Functionality succeeded.
+//          MIstatus::failure - Functionality failed.
+// Throws:  None.
+//--
+bool CMIDriverCmdReader::ThreadFinish() { return MIstatus::success; }
+
+//++
+// Details: Retrieve *this thread object's name.
+// Type:    Overridden.
+// Args:    None.
+// Return:  CMIUtilString & - Text.
+// Throws:  None.
+//--
+const CMIUtilString &CMIDriverCmdReader::ThreadGetName() const {
+  return m_constStrThisThreadId;
+}
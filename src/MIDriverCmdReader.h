@@ -0,0 +1,118 @@
+//===-- MIDriverCmdReader.h -------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+// In-house headers:
+#include "MICmdData.h"
+#include "MICmnBase.h"
+#include "MIUtilSingletonBase.h"
+#include "MIUtilString.h"
+#include "MIUtilThreadBaseStd.h"
+
+//++
+//============================================================================
+// Details: MI driver command reader. Reads the client's commands from stdin
+//          in its own worker thread and interprets each as it arrives, so the
+//          next command is ready as soon as the driver has finished the one
+//          it is running. The driver takes the commands off the queue in the
+//          order they were read so the MI records are output in the same
+//          order as before.
+//          The thread is not given to the thread manager as it blocks reading
+//          stdin, StopThread() leaves it to end with the application. Once
+//          StopThread() returns the thread interprets no more lines, so the
+//          modules the input uses can be shut down.
+//          A singleton class.
+//--
+class CMIDriverCmdReader : public CMICmnBase,
+                           public CMIUtilThreadActiveObjBase,
+                           public MI::ISingleton<CMIDriverCmdReader> {
+  friend class MI::ISingleton<CMIDriverCmdReader>;
+
+  // Structs:
+public:
+  //++
+  // Details: A line read from stdin and what the interpreter made of it.
+  //--
+  struct SCmd {
+    /* ctor */ SCmd();
+    //
+    CMIUtilString strMiTextLine; // The line, CLI commands wrapped as MI
+    SMICmdData cmdData;          // Filled in by the command interpreter
+    bool bCmdYesValid; // True = line is a valid MI command, false = not
+    bool bCmdNotInCmdFactory; // True = MI command has no implementation
+    bool bEndOfInput; // True = stdin was closed, no line, false = a line
+  };
+
+  //++
+  // Details: Where the reader takes the client's commands from and how it
+  //          has them interpreted, the driver in the application.
+  //          The functions are called by the reader's thread.
+  //--
+  class IInput {
+  public:
+    virtual const char *ReadCmdLine(CMIUtilString &vwErrMsg,
+                                    bool &vwbEndOfInput) = 0;
+    virtual void InterpretCmdLine(const CMIUtilString &vTextLine,
+                                  SCmd &vwCmd) = 0;
+
+    /* dtor */ virtual ~IInput() {}
+  };
+
+  // Methods:
+public:
+  bool Initialize() override;
+  bool Shutdown() override;
+  //
+  bool StartThread(IInput &vrInput);
+  void StopThread();
+  bool Pop(SCmd &vwCmd);
+  void WakeUp();
+
+  // Overridden:
+public:
+  // From CMIUtilThreadActiveObjBase
+  const CMIUtilString &ThreadGetName() const override;
+
+  // Overridden:
+protected:
+  // From CMIUtilThreadActiveObjBase
+  bool ThreadRun(bool &vrbIsAlive) override;
+  bool ThreadFinish() override;
+
+  // Typedefs:
+private:
+  typedef std::deque<SCmd> QueueCmd_t;
+
+  // Methods:
+private:
+  /* ctor */ CMIDriverCmdReader();
+  /* ctor */ CMIDriverCmdReader(const CMIDriverCmdReader &);
+  void operator=(const CMIDriverCmdReader &);
+  //
+  void Push(const SCmd &vCmd);
+
+  // Overridden:
+private:
+  // From CMICmnBase
+  /* dtor */ ~CMIDriverCmdReader() override;
+
+  // Attributes:
+private:
+  const CMIUtilString m_constStrThisThreadId;
+  IInput *m_pInput; // The commands' source, set by StartThread()
+  QueueCmd_t m_queueCmds; // Commands read but not yet taken by the driver
+  bool m_bWakeUp; // True = Pop() to return even if no command is queued
+  std::mutex m_mutexQueue;
+  std::condition_variable m_conditionQueue; // Signalled on Push() or WakeUp()
+};
@@ -0,0 +1,162 @@
+//===-- MIUtilCStringReader.h -----------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+// In-house headers:
+#include "MIDataTypes.h"
+#include "MIUtilString.h"
+
+//++
+//============================================================================
+// Details: MI common code utility class. Reads a null terminated string of
+//          char, char16_t or char32_t from memory and gives it in printable
+//          form, quotes escaped. The memory is read up to the end of a page
+//          at a time rather than a character at a time, never crossing into
+//          the next page which may not be readable. Reading stops at the
+//          null character or the maximum length.
+//          Memory is read by a function given to Read(), called as
+//          size_t (MIuint64 vnAddr, void *vpBuf, size_t vnBytes) and
+//          returning the number of bytes read, fewer than asked for when the
+//          rest cannot be read.
+//--
+template <typename charT> class CMIUtilCStringReader {
+  // Statics:
+public:
+  static const MIuint64 ms_nPageSize = 4096;
+
+  //++
+  // Details: Read a string from memory.
+  // Type:    Static method.
+  // Args:    vnAddr      - (R) Address of the first character.
+  //          vnMaxLen    - (R) Most characters to read.
+  //          vrReadFn    - (R) Function reading memory.
+  //          vwrText     - (W) Text to append the printable string to.
+  // Return:  bool - True = string read, false = it runs into memory that
+  //          cannot be read.
+  // Throws:  None.
+  //--
+  template <typename ReadFnT>
+  static bool Read(MIuint64 vnAddr, const MIuint64 vnMaxLen,
+                   const ReadFnT &vrReadFn, std::string &vwrText) {
+    const MIuint64 nEndAddr = vnAddr + vnMaxLen * sizeof(charT);
+    charT aChars[ms_nPageSize / sizeof(charT)];
+    while (vnAddr < nEndAddr) {
+      const size_t nBytes = GetChunkBytes(vnAddr, nEndAddr);
+      const size_t nReadBytes = vrReadFn(vnAddr, aChars, nBytes);
+      const size_t nChars = nReadBytes / sizeof(charT);
+      if (nChars == 0)
+        return false;
+
+      const charT *pEnd = FindNullChar(aChars, nChars);
+      AppendPrintableChars(vwrText, aChars, pEnd);
+      if (pEnd != aChars + nChars)
+        break;
+      if (nReadBytes != nBytes)
+        return false;
+      vnAddr += nBytes;
+    }
+
+    return true;
+  }
+
+  //++
+  // Details: Retrieve the number of bytes to read in one go, up to the end of
+  //          the page or the end of the string. A character across the end of
+  //          the page is read on its own.
+  // Type:    Static method.
+  // Args:    vnAddr      - (R) Address to read from.
+  //          vnEndAddr   - (R) Address after the last character to read.
+  // Return:  size_t - Number of bytes, a whole number of characters.
+  // Throws:  None.
+  //--
+  static size_t GetChunkBytes(const MIuint64 vnAddr,
+                              const MIuint64 vnEndAddr) {
+    const MIuint64 nPageEnd = (vnAddr | (ms_nPageSize - 1)) + 1;
+    size_t nBytes = static_cast<size_t>(std::min(nPageEnd, vnEndAddr) - vnAddr);
+    nBytes -= nBytes % sizeof(charT);
+    return (nBytes != 0) ? nBytes : sizeof(charT);
+  }
+
+  //++
+  // Details: Find the first null character of some characters.
+  // Type:    Static method.
+  // Args:    vpChars - (R) The characters.
+  //          vnChars - (R) Number of characters.
+  // Return:  charT * - The null character, vpChars + vnChars = none found.
+  // Throws:  None.
+  //--
+  static const charT *FindNullChar(const charT *vpChars,
+                                   const size_t vnChars) {
+    return std::find(vpChars, vpChars + vnChars, charT(0));
+  }
+
+  //++
+  // Details: Append characters to text in printable form, escaping quotes.
+  //          Printable ASCII other than the escaped characters is kept as it
+  //          is.
+  // Type:    Static method.
+  // Args:    vwrText - (W) Text to append to.
+  //          vpChars - (R) First character.
+  //          vpEnd   - (R) One past the last character.
+  // Return:  None.
+  // Throws:  None.
+  //--
+  static void AppendPrintableChars(std::string &vwrText, const charT *vpChars,
+                                   const charT *vpEnd) {
+    for (; vpChars != vpEnd; ++vpChars) {
+      const charT ch = *vpChars;
+      if ((ch >= 0x20) && (ch < 0x7f) && (ch != '"') && (ch != '\\'))
+        vwrText.push_back(static_cast<char>(ch));
+      else
+        vwrText.append(CMIUtilString::ConvertToPrintableASCII(
+            ch, true /* bEscapeQuotes */));
+    }
+  }
+};
+
+//++
+// Details: Find the first null character of some chars, with memchr.
+// Type:    Static method.
+// Args:    vpChars - (R) The characters.
+//          vnChars - (R) Number of characters.
+// Return:  char * - The null character, vpChars + vnChars = none found.
+// Throws:  None.
+//--
+template <>
+inline const char *
+CMIUtilCStringReader<char>::FindNullChar(const char *vpChars,
+                                         const size_t vnChars) {
+  const void *pNull = ::memchr(vpChars, 0, vnChars);
+  return (pNull != nullptr) ? static_cast<const char *>(pNull)
+                            : vpChars + vnChars;
+}
+
+//++
+// Details: Append chars to text in printable form, escaping quotes, in one
+//          pass.
+// Type:    Static method.
+// Args:    vwrText - (W) Text to append to.
+//          vpChars - (R) First character.
+//          vpEnd   - (R) One past the last character.
+// Return:  None.
+// Throws:  None.
+//--
+template <>
+inline void CMIUtilCStringReader<char>::AppendPrintableChars(
+    std::string &vwrText, const char *vpChars, const char *vpEnd) {
+  const bool bEscapeQuotes = true;
+  vwrText.append(
+      CMIUtilString(std::string(vpChars, vpEnd)).Escape(bEscapeQuotes));
+}
@@ -0,0 +1,434 @@
+//===-- MIUtilEncode.cpp ----------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Third party headers:
+#include <cstdint>
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define MI_UTIL_ENCODE_HAVE_SSE2 1
+#endif
+
+// In-house headers:
+#include "MIUtilEncode.h"
+
+namespace {
+// Lower case hex text of every byte value, two characters per byte
+struct SHexTable {
+  char m_digits[256][2];
+  SHexTable() {
+    const char *pDigits = "0123456789abcdef";
+    for (int i = 0; i < 256; ++i) {
+      m_digits[i][0] = pDigits[i >> 4];
+      m_digits[i][1] = pDigits[i & 0x0f];
+    }
+  }
+};
+
+// Value of every hex digit character, -1 for any other character
+struct SHexValueTable {
+  int8_t m_values[256];
+  SHexValueTable() {
+    for (int i = 0; i < 256; ++i)
+      m_values[i] = -1;
+    for (int i = 0; i < 10; ++i)
+      m_values['0' + i] = static_cast<int8_t>(i);
+    for (int i = 0; i < 6; ++i) {
+      m_values['a' + i] = static_cast<int8_t>(10 + i);
+      m_values['A' + i] = static_cast<int8_t>(10 + i);
+    }
+  }
+};
+
+const char gBase64Digits[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Value of every base64 digit character, -1 for any other character
+struct SBase64ValueTable {
+  int8_t m_values[256];
+  SBase64ValueTable() {
+    for (int i = 0; i < 256; ++i)
+      m_values[i] = -1;
+    for (int i = 0; i < 64; ++i)
+      m_values[static_cast<unsigned char>(gBase64Digits[i])] =
+          static_cast<int8_t>(i);
+  }
+};
+
+const SHexTable gHexTable;
+const SHexValueTable gHexValueTable;
+const SBase64ValueTable gBase64ValueTable;
+
+const char *const gEncodingNames[CMIUtilEncode::eEncoding_count] = {
+    "hex", "base64", "rle"};
+} // namespace
+
+// Instantiations:
+// A run is written as "hh*N;" so shorter runs are cheaper as plain hex
+const size_t CMIUtilEncode::ms_nRunLengthMin = 4;
+const size_t CMIUtilEncode::ms_nDecodeSizeMax = 1u << 30;
+
+//++
+// Details: Retrieve the encoding an MI command argument names.
+// Type:    Static method.
+// Args:    vName       - (R) Encoding name, "hex", "base64" or "rle".
+//          vwEncoding  - (W) The encoding.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed, name not recognised.
+// Throws:  None.
+//--
+bool CMIUtilEncode::GetEncoding(const CMIUtilString &vName,
+                                Encoding_e &vwEncoding) {
+  for (int i = 0; i < eEncoding_count; ++i) {
+    if (vName == gEncodingNames[i]) {
+      vwEncoding = static_cast<Encoding_e>(i);
+      return MIstatus::success;
+    }
+  }
+
+  return MIstatus::failure;
+}
+
+//++
+// Details: Retrieve the name MI uses for an encoding.
+// Type:    Static method.
+// Args:    veEncoding  - (R) The encoding.
+// Return:  const char * - Encoding name.
+// Throws:  None.
+//--
+const char *CMIUtilEncode::GetEncodingName(const Encoding_e veEncoding) {
+  return gEncodingNames[veEncoding];
+}
+
+//++
+// Details: Append the text of a block of bytes in the given encoding.
+// Type:    Static method.
+// Args:    vwrText     - (W) Text to append to.
+//          veEncoding  - (R) The encoding.
+//          vpData      - (R) Bytes to encode.
+//          vnLen       - (R) Number of bytes.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilEncode::Append(CMIUtilString &vwrText, const Encoding_e veEncoding,
+                           const unsigned char *vpData, const size_t vnLen) {
+  switch (veEncoding) {
+  case eEncoding_Base64:
+    AppendBase64(vwrText, vpData, vnLen);
+    break;
+  case eEncoding_RunLength:
+    AppendRunLength(vwrText, vpData, vnLen);
+    break;
+  default:
+    AppendHex(vwrText, vpData, vnLen);
+    break;
+  }
+}
+
+//++
+// Details: Decode text in the given encoding into a block of bytes.
+// Type:    Static method.
+// Args:    veEncoding  - (R) The encoding.
+//          vpText      - (R) Encoded text.
+//          vnTextLen   - (R) Length of the text.
+//          vnMaxSize   - (R) Most bytes run length text may decode to, hex
+//                        and base64 text is no shorter than its bytes.
+//          vwrData     - (W) The bytes, replaces any previous contents.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed, the text is not valid for
+//          the encoding.
+// Throws:  None.
+//--
+bool CMIUtilEncode::Decode(const Encoding_e veEncoding, const char *vpText,
+                           const size_t vnTextLen, const size_t vnMaxSize,
+                           std::vector<unsigned char> &vwrData) {
+  switch (veEncoding) {
+  case eEncoding_Base64:
+    return DecodeBase64(vpText, vnTextLen, vwrData);
+  case eEncoding_RunLength:
+    return DecodeRunLength(vpText, vnTextLen, vnMaxSize, vwrData);
+  default:
+    vwrData.resize(vnTextLen >> 1);
+    return DecodeHex(vpText, vnTextLen, vwrData.data());
+  }
+}
+
+//++
+// Details: Append the lower case hex text of a block of bytes, two digits per
+//          byte. Where SSE2 is available 16 bytes are encoded at a time.
+// Type:    Static method.
+// Args:    vwrText - (W) Text to append to.
+//          vpData  - (R) Bytes to encode.
+//          vnLen   - (R) Number of bytes.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilEncode::AppendHex(CMIUtilString &vwrText,
+                              const unsigned char *vpData, const size_t vnLen) {
+  const size_t nStart = vwrText.size();
+  vwrText.resize(nStart + (vnLen << 1));
+  char *pText = &vwrText[nStart];
+
+  size_t i = 0;
+#if MI_UTIL_ENCODE_HAVE_SSE2
+  const __m128i vLowNibble = _mm_set1_epi8(0x0f);
+  const __m128i vNine = _mm_set1_epi8(9);
+  const __m128i vZero = _mm_set1_epi8('0');
+  const __m128i vAlphaOffset = _mm_set1_epi8('a' - '0' - 10);
+  for (; i + 16 <= vnLen; i += 16) {
+    const __m128i vBytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(vpData + i));
+    const __m128i vHigh = _mm_and_si128(_mm_srli_epi16(vBytes, 4), vLowNibble);
+    const __m128i vLow = _mm_and_si128(vBytes, vLowNibble);
+    // Digit = nibble + '0', plus the gap up to 'a' for nibbles above 9
+    const __m128i vHighDigits = _mm_add_epi8(
+        _mm_add_epi8(vHigh, vZero),
+        _mm_and_si128(_mm_cmpgt_epi8(vHigh, vNine), vAlphaOffset));
+    const __m128i vLowDigits = _mm_add_epi8(
+        _mm_add_epi8(vLow, vZero),
+        _mm_and_si128(_mm_cmpgt_epi8(vLow, vNine), vAlphaOffset));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pText),
+                     _mm_unpacklo_epi8(vHighDigits, vLowDigits));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pText + 16),
+                     _mm_unpackhi_epi8(vHighDigits, vLowDigits));
+    pText += 32;
+  }
+#endif // MI_UTIL_ENCODE_HAVE_SSE2
+
+  for (; i < vnLen; ++i) {
+    const char *pDigits = gHexTable.m_digits[vpData[i]];
+    *pText++ = pDigits[0];
+    *pText++ = pDigits[1];
+  }
+}
+
+//++
+// Details: Decode hex text, two digits per byte in either case, into a block
+//          of bytes.
+// Type:    Static method.
+// Args:    vpText      - (R) Hex text.
+//          vnTextLen   - (R) Length of the text. Must be even.
+//          vpData      - (W) Buffer of at least vnTextLen / 2 bytes.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed, the text has an odd length
+//          or a character that is not a hex digit.
+// Throws:  None.
+//--
+bool CMIUtilEncode::DecodeHex(const char *vpText, const size_t vnTextLen,
+                              unsigned char *vpData) {
+  if ((vnTextLen & 1) != 0)
+    return MIstatus::failure;
+
+  const unsigned char *pText = reinterpret_cast<const unsigned char *>(vpText);
+  const size_t nLen = vnTextLen >> 1;
+  int nInvalid = 0;
+  for (size_t i = 0; i < nLen; ++i) {
+    const int nHigh = gHexValueTable.m_values[pText[i << 1]];
+    const int nLow = gHexValueTable.m_values[pText[(i << 1) + 1]];
+    // Invalid digits are -1 so any one of them sets the sign bit
+    nInvalid |= nHigh | nLow;
+    vpData[i] = static_cast<unsigned char>((nHigh & 0x0f) << 4 | (nLow & 0x0f));
+  }
+
+  return (nInvalid >= 0) ? MIstatus::success : MIstatus::failure;
+}
+
+//++
+// Details: Append the base64 text, with '=' padding, of a block of bytes.
+// Type:    Static method.
+// Args:    vwrText - (W) Text to append to.
+//          vpData  - (R) Bytes to encode.
+//          vnLen   - (R) Number of bytes.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilEncode::AppendBase64(CMIUtilString &vwrText,
+                                 const unsigned char *vpData,
+                                 const size_t vnLen) {
+  const char *pDigits = gBase64Digits;
+  const size_t nStart = vwrText.size();
+  vwrText.resize(nStart + ((vnLen + 2) / 3) * 4);
+  char *pText = &vwrText[nStart];
+
+  size_t i = 0;
+  for (; i + 3 <= vnLen; i += 3) {
+    const MIuint nBits = (static_cast<MIuint>(vpData[i]) << 16) |
+                         (static_cast<MIuint>(vpData[i + 1]) << 8) |
+                         vpData[i + 2];
+    *pText++ = pDigits[nBits >> 18];
+    *pText++ = pDigits[(nBits >> 12) & 0x3f];
+    *pText++ = pDigits[(nBits >> 6) & 0x3f];
+    *pText++ = pDigits[nBits & 0x3f];
+  }
+
+  const size_t nLeft = vnLen - i;
+  if (nLeft != 0) {
+    MIuint nBits = static_cast<MIuint>(vpData[i]) << 16;
+    if (nLeft == 2)
+      nBits |= static_cast<MIuint>(vpData[i + 1]) << 8;
+    *pText++ = pDigits[nBits >> 18];
+    *pText++ = pDigits[(nBits >> 12) & 0x3f];
+    *pText++ = (nLeft == 2) ? pDigits[(nBits >> 6) & 0x3f] : '=';
+    *pText++ = '=';
+  }
+}
+
+//++
+// Details: Decode base64 text, with '=' padding, into a block of bytes.
+// Type:    Static method.
+// Args:    vpText      - (R) Base64 text.
+//          vnTextLen   - (R) Length of the text. Must be a multiple of 4.
+//          vwrData     - (W) The bytes, replaces any previous contents.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed, the text is not base64.
+// Throws:  None.
+//--
+bool CMIUtilEncode::DecodeBase64(const char *vpText, const size_t vnTextLen,
+                                 std::vector<unsigned char> &vwrData) {
+  vwrData.clear();
+  if ((vnTextLen & 3) != 0)
+    return MIstatus::failure;
+  if (vnTextLen == 0)
+    return MIstatus::success;
+
+  const unsigned char *pText = reinterpret_cast<const unsigned char *>(vpText);
+  size_t nPad = 0;
+  if (pText[vnTextLen - 1] == '=')
+    nPad = (pText[vnTextLen - 2] == '=') ? 2 : 1;
+  // The last quad holds at least one byte, that is two digits, so it can
+  // not have more than two pad characters
+  if ((nPad == 2) && (pText[vnTextLen - 3] == '='))
+    return MIstatus::failure;
+  vwrData.resize((vnTextLen / 4) * 3 - nPad);
+  unsigned char *pData = vwrData.data();
+
+  const int8_t *pValues = gBase64ValueTable.m_values;
+  const size_t nFullLen = (nPad == 0) ? vnTextLen : vnTextLen - 4;
+  int nInvalid = 0;
+  size_t i = 0;
+  for (; i < nFullLen; i += 4) {
+    const int n0 = pValues[pText[i]];
+    const int n1 = pValues[pText[i + 1]];
+    const int n2 = pValues[pText[i + 2]];
+    const int n3 = pValues[pText[i + 3]];
+    // Invalid digits are -1 so any one of them sets the sign bit
+    nInvalid |= n0 | n1 | n2 | n3;
+    const MIuint nBits = ((n0 & 0x3f) << 18) | ((n1 & 0x3f) << 12) |
+                         ((n2 & 0x3f) << 6) | (n3 & 0x3f);
+    *pData++ = static_cast<unsigned char>(nBits >> 16);
+    *pData++ = static_cast<unsigned char>(nBits >> 8);
+    *pData++ = static_cast<unsigned char>(nBits);
+  }
+
+  if (nPad != 0) {
+    const int n0 = pValues[pText[i]];
+    const int n1 = pValues[pText[i + 1]];
+    const int n2 = (nPad == 1) ? pValues[pText[i + 2]] : 0;
+    nInvalid |= n0 | n1 | n2;
+    const MIuint nBits =
+        ((n0 & 0x3f) << 18) | ((n1 & 0x3f) << 12) | ((n2 & 0x3f) << 6);
+    *pData++ = static_cast<unsigned char>(nBits >> 16);
+    if (nPad == 1)
+      *pData++ = static_cast<unsigned char>(nBits >> 8);
+  }
+
+  return (nInvalid >= 0) ? MIstatus::success : MIstatus::failure;
+}
+
+//++
+// Details: Append the run length encoded hex text of a block of bytes. Runs
+//          of ms_nRunLengthMin or more equal bytes are written as "hh*N;",
+//          everything in between as plain hex.
+// Type:    Static method.
+// Args:    vwrText - (W) Text to append to.
+//          vpData  - (R) Bytes to encode.
+//          vnLen   - (R) Number of bytes.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilEncode::AppendRunLength(CMIUtilString &vwrText,
+                                    const unsigned char *vpData,
+                                    const size_t vnLen) {
+  size_t nLiteral = 0;
+  size_t i = 0;
+  while (i < vnLen) {
+    size_t nRunEnd = i + 1;
+    while ((nRunEnd < vnLen) && (vpData[nRunEnd] == vpData[i]))
+      ++nRunEnd;
+    if (nRunEnd - i < ms_nRunLengthMin) {
+      i = nRunEnd;
+      continue;
+    }
+
+    AppendHex(vwrText, vpData + nLiteral, i - nLiteral);
+    AppendHex(vwrText, vpData + i, 1);
+    vwrText.AppendFormat("*%zu;", nRunEnd - i);
+    i = nLiteral = nRunEnd;
+  }
+  AppendHex(vwrText, vpData + nLiteral, vnLen - nLiteral);
+}
+
+//++
+// Details: Decode run length encoded hex text into a block of bytes. The text
+//          is not decoded past the most bytes given so a few characters
+//          cannot ask for more memory than the caller wants.
+// Type:    Static method.
+// Args:    vpText      - (R) Run length encoded text.
+//          vnTextLen   - (R) Length of the text.
+//          vnMaxSize   - (R) Most bytes the text may decode to.
+//          vwrData     - (W) The bytes, replaces any previous contents.
+// Return:  MIstatus::success - Functional succeeded.
+//          MIstatus::failure - Functional failed, the text is not valid or
+//          decodes to more than vnMaxSize bytes.
+// Throws:  None.
+//--
+bool CMIUtilEncode::DecodeRunLength(const char *vpText, const size_t vnTextLen,
+                                    const size_t vnMaxSize,
+                                    std::vector<unsigned char> &vwrData) {
+  vwrData.clear();
+  vwrData.reserve(vnTextLen >> 1);
+
+  size_t i = 0;
+  while (i < vnTextLen) {
+    // Plain hex up to the next run
+    size_t nLiteralEnd = i;
+    while ((nLiteralEnd < vnTextLen) && (vpText[nLiteralEnd] != '*'))
+      ++nLiteralEnd;
+    if (nLiteralEnd == vnTextLen) {
+      const size_t nStart = vwrData.size();
+      vwrData.resize(nStart + ((nLiteralEnd - i) >> 1));
+      return (vwrData.size() <= vnMaxSize) &&
+             DecodeHex(vpText + i, nLiteralEnd - i, vwrData.data() + nStart);
+    }
+
+    // The byte in front of the '*' is the one repeated
+    if (nLiteralEnd - i < 2)
+      return MIstatus::failure;
+    const size_t nStart = vwrData.size();
+    vwrData.resize(nStart + ((nLiteralEnd - i) >> 1));
+    if ((vwrData.size() > vnMaxSize) ||
+        !DecodeHex(vpText + i, nLiteralEnd - i, vwrData.data() + nStart))
+      return MIstatus::failure;
+
+    size_t nCount = 0;
+    i = nLiteralEnd + 1;
+    for (; (i < vnTextLen) && (vpText[i] >= '0') && (vpText[i] <= '9'); ++i) {
+      if (nCount > (SIZE_MAX - 9) / 10)
+        return MIstatus::failure;
+      nCount = nCount * 10 + (vpText[i] - '0');
+    }
+    if ((nCount == 0) || (i == vnTextLen) || (vpText[i] != ';'))
+      return MIstatus::failure;
+    ++i;
+    if (nCount - 1 > vnMaxSize - vwrData.size())
+      return MIstatus::failure;
+    vwrData.insert(vwrData.end(), nCount - 1, vwrData.back());
+  }
+
+  return MIstatus::success;
+}
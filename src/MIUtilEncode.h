@@ -0,0 +1,70 @@
+//===-- MIUtilEncode.h ------------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <cstddef>
+#include <vector>
+
+// In-house headers:
+#include "MIUtilString.h"
+
+//++
+//============================================================================
+// Details: MI common code utility class. Encodes blocks of target memory as
+//          text for MI records and decodes the text given by MI commands
+//          back into bytes. Text is written straight into the caller's
+//          buffer, no per byte formatting is done.
+//          Besides the hex MI uses by default memory can be given as base64
+//          or as run length encoded hex. The latter is hex where a byte
+//          repeated N times may be written as the byte, a '*', N in decimal
+//          and a ';', e.g. "00*4096;ff" for a zeroed page then 0xff.
+//--
+class CMIUtilEncode {
+  // Enumerations:
+public:
+  enum Encoding_e {
+    eEncoding_Hex = 0,
+    eEncoding_Base64,
+    eEncoding_RunLength,
+    eEncoding_count // Always the last one
+  };
+
+  // Statics:
+public:
+  static bool GetEncoding(const CMIUtilString &vName, Encoding_e &vwEncoding);
+  static const char *GetEncodingName(const Encoding_e veEncoding);
+  static void Append(CMIUtilString &vwrText, const Encoding_e veEncoding,
+                     const unsigned char *vpData, const size_t vnLen);
+  static bool Decode(const Encoding_e veEncoding, const char *vpText,
+                     const size_t vnTextLen, const size_t vnMaxSize,
+                     std::vector<unsigned char> &vwrData);
+  //
+  static void AppendHex(CMIUtilString &vwrText, const unsigned char *vpData,
+                        const size_t vnLen);
+  static bool DecodeHex(const char *vpText, const size_t vnTextLen,
+                        unsigned char *vpData);
+  static void AppendBase64(CMIUtilString &vwrText, const unsigned char *vpData,
+                           const size_t vnLen);
+  static bool DecodeBase64(const char *vpText, const size_t vnTextLen,
+                           std::vector<unsigned char> &vwrData);
+  static void AppendRunLength(CMIUtilString &vwrText,
+                              const unsigned char *vpData, const size_t vnLen);
+  static bool DecodeRunLength(const char *vpText, const size_t vnTextLen,
+                              const size_t vnMaxSize,
+                              std::vector<unsigned char> &vwrData);
+
+  // Attributes:
+public:
+  static const size_t ms_nDecodeSizeMax; // Most bytes to decode when the
+                                         // caller has no size of its own
+private:
+  static const size_t ms_nRunLengthMin; // Shortest run of one byte value
+                                        // written as a run
+};
@@ -0,0 +1,153 @@
+//===-- MIUtilHistogram.cpp -------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Third party headers:
+#include "llvm/Support/MathExtras.h"
+#include <algorithm>
+
+// In-house headers:
+#include "MIUtilHistogram.h"
+
+// Instantiations:
+const MIuint CMIUtilHistogram::ms_nSubBucketBits = 3;
+const MIuint64 CMIUtilHistogram::ms_nLinearMax =
+    2ull << CMIUtilHistogram::ms_nSubBucketBits;
+
+//++
+// Details: CMIUtilHistogram constructor.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+CMIUtilHistogram::CMIUtilHistogram() : m_nCount(0), m_nMax(0), m_nSum(0) {}
+
+//++
+// Details: Count a sample.
+// Type:    Method.
+// Args:    vnValue - (R) The sample.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilHistogram::Add(const MIuint64 vnValue) {
+  const MIuint nIndex = GetBucketIndex(vnValue);
+  if (nIndex >= m_vecBuckets.size())
+    m_vecBuckets.resize(nIndex + 1, 0);
+  ++m_vecBuckets[nIndex];
+
+  ++m_nCount;
+  m_nMax = std::max(m_nMax, vnValue);
+  m_nSum += vnValue;
+}
+
+//++
+// Details: Forget all the samples counted so far.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilHistogram::Clear() {
+  m_vecBuckets.clear();
+  m_nCount = 0;
+  m_nMax = 0;
+  m_nSum = 0;
+}
+
+//++
+// Details: Retrieve the number of samples counted.
+// Type:    Method.
+// Args:    None.
+// Return:  MIuint64 - Number of samples.
+// Throws:  None.
+//--
+MIuint64 CMIUtilHistogram::GetCount() const { return m_nCount; }
+
+//++
+// Details: Retrieve the largest sample counted.
+// Type:    Method.
+// Args:    None.
+// Return:  MIuint64 - Largest sample, 0 = no samples.
+// Throws:  None.
+//--
+MIuint64 CMIUtilHistogram::GetMax() const { return m_nMax; }
+
+//++
+// Details: Retrieve the total of the samples counted.
+// Type:    Method.
+// Args:    None.
+// Return:  MIuint64 - Sum of the samples.
+// Throws:  None.
+//--
+MIuint64 CMIUtilHistogram::GetSum() const { return m_nSum; }
+
+//++
+// Details: Retrieve the value the given percentage of samples do not exceed.
+//          The value is the top of the bucket the percentile falls in so it
+//          may be up to 1/8 above the true value, but never above the largest
+//          sample.
+// Type:    Method.
+// Args:    vnPercent   - (R) Percentile 0 to 100.
+// Return:  MIuint64 - Percentile value, 0 = no samples.
+// Throws:  None.
+//--
+MIuint64 CMIUtilHistogram::GetPercentile(const MIuint vnPercent) const {
+  if (m_nCount == 0)
+    return 0;
+
+  const MIuint64 nPercent = std::min<MIuint64>(vnPercent, 100);
+  const MIuint64 nRank =
+      std::max<MIuint64>((nPercent * m_nCount + 99) / 100, 1);
+  MIuint64 nSeen = 0;
+  for (size_t i = 0; i < m_vecBuckets.size(); ++i) {
+    nSeen += m_vecBuckets[i];
+    if (nSeen >= nRank)
+      return std::min(GetBucketHighest(static_cast<MIuint>(i)), m_nMax);
+  }
+
+  return m_nMax;
+}
+
+//++
+// Details: Retrieve the bucket a sample is counted in.
+// Type:    Static method.
+// Args:    vnValue - (R) The sample.
+// Return:  MIuint - Bucket index.
+// Throws:  None.
+//--
+MIuint CMIUtilHistogram::GetBucketIndex(const MIuint64 vnValue) {
+  if (vnValue < ms_nLinearMax)
+    return static_cast<MIuint>(vnValue);
+
+  const MIuint nExponent = llvm::Log2_64(vnValue);
+  const MIuint nShift = nExponent - ms_nSubBucketBits;
+  const MIuint nSubBucket =
+      static_cast<MIuint>(vnValue >> nShift) & ((1u << ms_nSubBucketBits) - 1);
+  return static_cast<MIuint>(ms_nLinearMax) +
+         ((nExponent - ms_nSubBucketBits - 1) << ms_nSubBucketBits) +
+         nSubBucket;
+}
+
+//++
+// Details: Retrieve the largest sample a bucket counts.
+// Type:    Static method.
+// Args:    vnIndex - (R) Bucket index.
+// Return:  MIuint64 - Largest value of the bucket.
+// Throws:  None.
+//--
+MIuint64 CMIUtilHistogram::GetBucketHighest(const MIuint vnIndex) {
+  if (vnIndex < ms_nLinearMax)
+    return vnIndex;
+
+  const MIuint nLog = vnIndex - static_cast<MIuint>(ms_nLinearMax);
+  const MIuint nShift = (nLog >> ms_nSubBucketBits) + 1;
+  const MIuint64 nSubBucket = nLog & ((1u << ms_nSubBucketBits) - 1);
+  const MIuint64 nLowest = ((1ull << ms_nSubBucketBits) + nSubBucket)
+                           << nShift;
+  return nLowest + ((1ull << nShift) - 1);
+}
@@ -0,0 +1,54 @@
+//===-- MIUtilHistogram.h ---------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <cstdint>
+#include <vector>
+
+// In-house headers:
+#include "MIDataTypes.h"
+
+//++
+//============================================================================
+// Details: MI common code utility class. Counts 64 bit samples, i.e. latencies
+//          in nanoseconds, in log linear buckets so percentiles can be read
+//          back at any time for a small fixed cost per sample. Values below
+//          16 have a bucket each, above that every power of two is split
+//          into 8 buckets so a percentile is never more than 1/8 above the
+//          true value. Buckets are only allocated up to the largest value
+//          seen.
+//--
+class CMIUtilHistogram {
+  // Methods:
+public:
+  /* ctor */ CMIUtilHistogram();
+  //
+  void Add(const MIuint64 vnValue);
+  void Clear();
+  MIuint64 GetCount() const;
+  MIuint64 GetMax() const;
+  MIuint64 GetSum() const;
+  MIuint64 GetPercentile(const MIuint vnPercent) const;
+
+  // Statics:
+private:
+  static MIuint GetBucketIndex(const MIuint64 vnValue);
+  static MIuint64 GetBucketHighest(const MIuint vnIndex);
+
+  // Attributes:
+private:
+  static const MIuint ms_nSubBucketBits; // Power of two splits are 2^this
+  static const MIuint64 ms_nLinearMax;   // Values below have a bucket each
+  //
+  std::vector<uint32_t> m_vecBuckets;
+  MIuint64 m_nCount;
+  MIuint64 m_nMax;
+  MIuint64 m_nSum;
+};
@@ -0,0 +1,239 @@
+//===-- MIUtilPerfectHash.h -------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+// Third party headers:
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace MI {
+
+//++
+// Details: Retrieve the number of slots a perfect hash of N names has, the
+//          power of two that leaves at least half of them free.
+// Type:    Function.
+// Args:    vnNames - (R) Number of names.
+// Return:  size_t - Number of slots.
+// Throws:  None.
+//--
+constexpr size_t PerfectHashSlotCount(const size_t vnNames) {
+  size_t nSlots = 8;
+  while (nSlots < 2 * vnNames)
+    nSlots <<= 1;
+  return nSlots;
+}
+} // namespace MI
+
+//++
+//============================================================================
+// Details: MI common code utility class. A perfect hash of a fixed set of
+//          names, built by the compiler from a constexpr table so looking up
+//          a name costs one probe of the table and one string compare.
+//          The names are hashed into buckets. Each bucket holding more than
+//          one name is given a seed that rehashes its names to free slots,
+//          a bucket with one name is given its slot directly (hash and
+//          displace). The table entries are either names or structs with a
+//          pName member, Find() returns the entry's index.
+//          A table with the same name twice, or one no seed up to
+//          ms_nSeedMax can place, does not build, IsValid() is false and
+//          should be checked with a static_assert.
+//--
+template <size_t N> class CMIUtilPerfectHash {
+  // Statics:
+public:
+  static constexpr size_t ms_nSlots = MI::PerfectHashSlotCount(N);
+  static_assert(N > 0, "A perfect hash needs names");
+
+  //++
+  // Details: Hash a name, seeds other than 0 are used to rehash.
+  // Type:    Static method.
+  // Args:    vpText  - (R) The name.
+  //          vnLen   - (R) Length of the name.
+  //          vnSeed  - (R) Seed.
+  // Return:  uint32_t - Hash value.
+  // Throws:  None.
+  //--
+  static constexpr uint32_t Hash(const char *vpText, const size_t vnLen,
+                                 const uint32_t vnSeed) {
+    // FNV-1a, then a final mix so the low bits used depend on every byte
+    uint32_t nHash = 2166136261u ^ (vnSeed * 0x9e3779b9u);
+    for (size_t i = 0; i < vnLen; ++i) {
+      nHash ^= static_cast<unsigned char>(vpText[i]);
+      nHash *= 16777619u;
+    }
+    nHash ^= nHash >> 16;
+    nHash *= 0x7feb352du;
+    nHash ^= nHash >> 15;
+    return nHash;
+  }
+
+  // Methods:
+public:
+  //++
+  // Details: CMIUtilPerfectHash constructor. Builds the hash of a table.
+  // Type:    Method.
+  // Args:    vrEntries   - (R) The table, names or structs with a pName.
+  // Return:  None.
+  // Throws:  None.
+  //--
+  template <typename T>
+  constexpr CMIUtilPerfectHash(const T (&vrEntries)[N])
+      : m_apNames(), m_anLen(), m_anDisplace(), m_anSlotToIndex(),
+        m_bValid(false) {
+    size_t anBucket[N] = {};
+    size_t anBucketSize[ms_nSlots] = {};
+    size_t nBucketSizeMax = 0;
+    for (size_t i = 0; i < N; ++i) {
+      m_apNames[i] = GetName(vrEntries[i]);
+      while (m_apNames[i][m_anLen[i]] != '\0')
+        ++m_anLen[i];
+      anBucket[i] = Hash(m_apNames[i], m_anLen[i], 0) & (ms_nSlots - 1);
+      ++anBucketSize[anBucket[i]];
+      if (anBucketSize[anBucket[i]] > nBucketSizeMax)
+        nBucketSizeMax = anBucketSize[anBucket[i]];
+    }
+    for (size_t i = 0; i < ms_nSlots; ++i)
+      m_anSlotToIndex[i] = -1;
+
+    // Place the fullest buckets first while most slots are free
+    size_t anKeys[N] = {};
+    size_t anKeySlot[N] = {};
+    for (size_t nSize = nBucketSizeMax; nSize > 1; --nSize) {
+      for (size_t nBucket = 0; nBucket < ms_nSlots; ++nBucket) {
+        if (anBucketSize[nBucket] != nSize)
+          continue;
+        size_t nKeys = 0;
+        for (size_t i = 0; i < N; ++i)
+          if (anBucket[i] == nBucket)
+            anKeys[nKeys++] = i;
+        // Names that are the same never separate
+        for (size_t k = 1; k < nKeys; ++k)
+          for (size_t j = 0; j < k; ++j)
+            if (IsSameName(anKeys[j], anKeys[k]))
+              return;
+
+        uint32_t nSeed = 1;
+        for (; nSeed < ms_nSeedMax; ++nSeed) {
+          bool bFree = true;
+          for (size_t k = 0; bFree && (k < nKeys); ++k) {
+            const size_t nKey = anKeys[k];
+            anKeySlot[k] =
+                Hash(m_apNames[nKey], m_anLen[nKey], nSeed) & (ms_nSlots - 1);
+            bFree = (m_anSlotToIndex[anKeySlot[k]] < 0);
+            for (size_t j = 0; bFree && (j < k); ++j)
+              bFree = (anKeySlot[j] != anKeySlot[k]);
+          }
+          if (bFree)
+            break;
+        }
+        if (nSeed == ms_nSeedMax)
+          return;
+
+        for (size_t k = 0; k < nKeys; ++k)
+          m_anSlotToIndex[anKeySlot[k]] = static_cast<int32_t>(anKeys[k]);
+        m_anDisplace[nBucket] = static_cast<int32_t>(nSeed);
+      }
+    }
+
+    size_t nSlotFree = 0;
+    for (size_t i = 0; i < N; ++i) {
+      if (anBucketSize[anBucket[i]] != 1)
+        continue;
+      while (m_anSlotToIndex[nSlotFree] >= 0)
+        ++nSlotFree;
+      m_anSlotToIndex[nSlotFree] = static_cast<int32_t>(i);
+      m_anDisplace[anBucket[i]] = -static_cast<int32_t>(nSlotFree) - 1;
+    }
+
+    m_bValid = true;
+  }
+
+  //++
+  // Details: Check the table's names could all be given their own slot.
+  // Type:    Method.
+  // Args:    None.
+  // Return:  bool - True = valid, false = the table has the same name twice
+  //          or no seed was found for one of its buckets.
+  // Throws:  None.
+  //--
+  constexpr bool IsValid() const { return m_bValid; }
+
+  //++
+  // Details: Look up a name.
+  // Type:    Method.
+  // Args:    vpName  - (R) The name, need not be null terminated.
+  //          vnLen   - (R) Length of the name.
+  // Return:  int - Index of the name's entry in the table, -1 = not found.
+  // Throws:  None.
+  //--
+  int Find(const char *vpName, const size_t vnLen) const {
+    const int32_t nDisplace =
+        m_anDisplace[Hash(vpName, vnLen, 0) & (ms_nSlots - 1)];
+    if (nDisplace == 0)
+      return -1;
+
+    const size_t nSlot =
+        (nDisplace < 0)
+            ? static_cast<size_t>(-(nDisplace + 1))
+            : (Hash(vpName, vnLen, static_cast<uint32_t>(nDisplace)) &
+               (ms_nSlots - 1));
+    const int32_t nIndex = m_anSlotToIndex[nSlot];
+    if ((nIndex < 0) || (m_anLen[nIndex] != vnLen) ||
+        (::memcmp(m_apNames[nIndex], vpName, vnLen) != 0))
+      return -1;
+    return nIndex;
+  }
+
+  // Statics:
+private:
+  static constexpr uint32_t ms_nSeedMax = 1u << 12;
+
+  //++
+  // Details: Retrieve the name of a table entry.
+  // Type:    Static method.
+  // Args:    vrEntry - (R) Table entry.
+  // Return:  const char * - Name.
+  // Throws:  None.
+  //--
+  static constexpr const char *GetName(const char *vpName) { return vpName; }
+  template <typename T> static constexpr const char *GetName(const T &vrEntry) {
+    return vrEntry.pName;
+  }
+
+  // Methods:
+private:
+  //++
+  // Details: Check whether two of the table's names are the same.
+  // Type:    Method.
+  // Args:    vnIndex1    - (R) Index of an entry.
+  //          vnIndex2    - (R) Index of another entry.
+  // Return:  bool - True = same name, false = different.
+  // Throws:  None.
+  //--
+  constexpr bool IsSameName(const size_t vnIndex1,
+                            const size_t vnIndex2) const {
+    if (m_anLen[vnIndex1] != m_anLen[vnIndex2])
+      return false;
+    for (size_t i = 0; i < m_anLen[vnIndex1]; ++i)
+      if (m_apNames[vnIndex1][i] != m_apNames[vnIndex2][i])
+        return false;
+    return true;
+  }
+
+  // Attributes:
+private:
+  const char *m_apNames[N];
+  size_t m_anLen[N];
+  int32_t m_anDisplace[ms_nSlots]; // Per bucket, 0 = no names, < 0 = the one
+                                   // name's slot + 1 negated, > 0 = seed
+                                   // that rehashes the names to their slots
+  int32_t m_anSlotToIndex[ms_nSlots]; // Table index, -1 = free slot
+  bool m_bValid; // True = every name has a slot, false = a name is repeated
+};
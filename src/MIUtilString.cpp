@@ -8,6 +8,10 @@
 
 // Third party headers
 #include "llvm/Support/Compiler.h"
+#include "llvm/Support/MathExtras.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <inttypes.h>
 #include <limits.h>
@@ -16,9 +20,172 @@
 #include <stdarg.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define MI_UTIL_STRING_HAVE_SSE2 1
+#endif
+
 // In-house headers:
 #include "MIUtilString.h"
 
+//++
+// Details: Find the first character in the text that Escape() or
+//          AddSlashes() cannot copy as it is: a '\\', optionally a '"' and,
+//          when escaping, anything that is not printable 7 bit ASCII. Where
+//          SSE2 is available 16 characters are tested at a time.
+// Type:    Function.
+// Args:    vpText      - (R) Text to scan.
+//          vnLen       - (R) Length of the text.
+//          vbControl   - (R) True = stop at non printable characters too.
+//          vbQuote     - (R) True = stop at '"' too.
+// Return:  size_t - Position of the character or vnLen if there is none.
+// Throws:  None.
+//--
+static size_t FindFirstCharToEscape(const char *vpText, const size_t vnLen,
+                                    const bool vbControl, const bool vbQuote) {
+  size_t nPos = 0;
+#if MI_UTIL_STRING_HAVE_SSE2
+  const __m128i vBckSlash = _mm_set1_epi8('\\');
+  const __m128i vQuote = _mm_set1_epi8(vbQuote ? '"' : '\\');
+  // Bytes from 0x80 are negative so one signed compare finds them along with
+  // the control characters below ' '
+  const __m128i vSpace = _mm_set1_epi8(vbControl ? ' ' : -128);
+  const __m128i vDelete = _mm_set1_epi8(vbControl ? 0x7f : '\\');
+  for (; nPos + 16 <= vnLen; nPos += 16) {
+    const __m128i vChars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(vpText + nPos));
+    __m128i vMatch = _mm_cmpeq_epi8(vChars, vBckSlash);
+    vMatch = _mm_or_si128(vMatch, _mm_cmpeq_epi8(vChars, vQuote));
+    vMatch = _mm_or_si128(vMatch, _mm_cmplt_epi8(vChars, vSpace));
+    vMatch = _mm_or_si128(vMatch, _mm_cmpeq_epi8(vChars, vDelete));
+    const int nMask = _mm_movemask_epi8(vMatch);
+    if (nMask != 0)
+      return nPos + llvm::countTrailingZeros(static_cast<unsigned>(nMask));
+  }
+#endif // MI_UTIL_STRING_HAVE_SSE2
+
+  for (; nPos < vnLen; ++nPos) {
+    const unsigned char c = static_cast<unsigned char>(vpText[nPos]);
+    if ((c == '\\') || (vbQuote && (c == '"')) ||
+        (vbControl && ((c < ' ') || (c >= 0x7f))))
+      return nPos;
+  }
+
+  return vnLen;
+}
+
+//++
+// Details: Append the escape sequence Escape() forms for one character that
+//          FindFirstCharToEscape() stopped at. When also adding slashes every
+//          '\\' and '"' of the sequence is itself escaped, giving the same
+//          text as Escape().AddSlashes().
+// Type:    Function.
+// Args:    vwrText         - (W) Text to append to.
+//          vChar           - (R) The character.
+//          vbEscapeQuotes  - (R) True = escape '"', false = keep it as is.
+//          vbAddSlashes    - (R) True = add slashes as well.
+// Return:  None.
+// Throws:  None.
+//--
+static void AppendEscapedChar(std::string &vwrText, const char vChar,
+                              const bool vbEscapeQuotes,
+                              const bool vbAddSlashes) {
+  char sequence[16];
+  size_t nLen = 2;
+  sequence[0] = '\\';
+  switch (vChar) {
+  case '\a':
+    sequence[1] = 'a';
+    break;
+  case '\b':
+    sequence[1] = 'b';
+    break;
+  case '\t':
+    sequence[1] = 't';
+    break;
+  case '\n':
+    sequence[1] = 'n';
+    break;
+  case '\v':
+    sequence[1] = 'v';
+    break;
+  case '\f':
+    sequence[1] = 'f';
+    break;
+  case '\r':
+    sequence[1] = 'r';
+    break;
+  case '\033':
+    sequence[1] = 'e';
+    break;
+  case '\\':
+    sequence[1] = '\\';
+    break;
+  case '"':
+    if (vbEscapeQuotes)
+      sequence[1] = '"';
+    else {
+      sequence[0] = '"';
+      nLen = 1;
+    }
+    break;
+  default:
+    // Same text as Format("\\x%02" PRIx8, vChar), a char above 0x7f is
+    // sign extended
+    if ((vChar >= ' ') && (vChar < 0x7f)) {
+      sequence[0] = vChar;
+      nLen = 1;
+    } else
+      nLen = ::snprintf(sequence, sizeof(sequence), "\\x%02" PRIx8, vChar);
+    break;
+  }
+
+  if (!vbAddSlashes) {
+    vwrText.append(sequence, nLen);
+    return;
+  }
+  for (size_t i = 0; i < nLen; ++i) {
+    if ((sequence[i] == '\\') || (sequence[i] == '"'))
+      vwrText.push_back('\\');
+    vwrText.push_back(sequence[i]);
+  }
+}
+
+//++
+// Details: Escape text, see CMIUtilString::Escape(), copying runs of
+//          characters that need no escaping in bulk.
+// Type:    Function.
+// Args:    vrText          - (R) Text to escape.
+//          vbEscapeQuotes  - (R) True = escape '"', false = keep it as is.
+//          vbAddSlashes    - (R) True = also add slashes to the escaped text.
+// Return:  CMIUtilString - The escaped text.
+// Throws:  None.
+//--
+static CMIUtilString EscapeText(const std::string &vrText,
+                                const bool vbEscapeQuotes,
+                                const bool vbAddSlashes) {
+  const char *pText = vrText.data();
+  const size_t nLen = vrText.length();
+  CMIUtilString strNew;
+  strNew.reserve(nLen + (nLen >> 4) + 2);
+
+  const bool bStopAtQuote = vbEscapeQuotes || vbAddSlashes;
+  size_t nOffset = 0;
+  while (nOffset < nLen) {
+    const size_t nPos = nOffset + FindFirstCharToEscape(pText + nOffset,
+                                                        nLen - nOffset, true,
+                                                        bStopAtQuote);
+    strNew.append(pText + nOffset, nPos - nOffset);
+    if (nPos == nLen)
+      break;
+    AppendEscapedChar(strNew, pText[nPos], vbEscapeQuotes, vbAddSlashes);
+    nOffset = nPos + 1;
+  }
+
+  return strNew;
+}
+
 //++
 // Details: CMIUtilString constructor.
 // Type:    Method.
@@ -93,8 +260,8 @@ CMIUtilString::~CMIUtilString() {}
 CMIUtilString CMIUtilString::FormatPriv(const CMIUtilString &vrFormat,
                                         va_list vArgs) {
   CMIUtilString strResult;
-  MIint nFinal = 0;
-  MIint n = vrFormat.size();
+  if (vrFormat.empty())
+    return strResult;
 
   // IOR: mysterious crash in this function on some windows builds not able to
   // duplicate but found article which may be related. Crash occurs in
@@ -105,36 +272,27 @@ CMIUtilString CMIUtilString::FormatPriv(const CMIUtilString &vrFormat,
   va_list argsDup;
   va_copy(argsDup, vArgs);
 
-  // Create a copy va_list to reset when we spin
+  // Create a copy va_list in case we need a second pass
   va_list argsCpy;
   va_copy(argsCpy, argsDup);
 
-  if (n == 0)
-    return strResult;
-
-  n = n << 4; // Reserve 16 times as much the length of the vrFormat
-
-  std::unique_ptr<char[]> pFormatted;
-  while (1) {
-    pFormatted.reset(new char[n + 1]); // +1 for safety margin
-    ::strncpy(&pFormatted[0], vrFormat.c_str(), n);
-
-    // We need to restore the variable argument list pointer to the start again
-    // before running vsnprintf() more then once
-    va_copy(argsDup, argsCpy);
-
-    nFinal = ::vsnprintf(&pFormatted[0], n, vrFormat.c_str(), argsDup);
-    if ((nFinal < 0) || (nFinal >= n))
-      n += abs(nFinal - n + 1);
-    else
-      break;
+  // Most text formed is short so try a buffer on the stack first and only
+  // format a second time, straight into the result, when it does not fit
+  char buffer[256];
+  const MIint nFinal =
+      ::vsnprintf(buffer, sizeof(buffer), vrFormat.c_str(), argsDup);
+  if (nFinal >= 0) {
+    if (static_cast<size_t>(nFinal) < sizeof(buffer))
+      strResult.assign(buffer, nFinal);
+    else {
+      strResult.resize(nFinal);
+      ::vsnprintf(&strResult[0], nFinal + 1, vrFormat.c_str(), argsCpy);
+    }
   }
 
   va_end(argsCpy);
   va_end(argsDup);
 
-  strResult = pFormatted.get();
-
   return strResult;
 }
 
@@ -173,6 +331,331 @@ CMIUtilString CMIUtilString::FormatValist(const CMIUtilString &vrFormating,
   return CMIUtilString::FormatPriv(vrFormating, vArgs);
 }
 
+//++
+// Details: Format the arguments as directed by the printf style format string
+//          and append the text to *this string. See FormatTyped().
+//          A conversion with no argument left for it, an argument of a type
+//          the conversion does not take or arguments left over are a bug in
+//          the caller. They assert in a debug build and otherwise show as
+//          "%!<conv>(MISSING)", "%!<conv>(BADTYPE)" or "%!(EXTRA)" in the text.
+// Type:    Method.
+// Args:    vpFormat    - (R) Format string data instruction.
+//          vpArgs      - (R) Array of arguments.
+//          vnArgs      - (R) Number of arguments in the array.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilString::AppendFormatPriv(const char *vpFormat,
+                                     const SFormatArg *vpArgs,
+                                     const size_t vnArgs) {
+  if (vpFormat == nullptr)
+    return;
+
+  size_t nArg = 0;
+  const char *pText = vpFormat;
+  while (*pText != '\0') {
+    // Copy the literal text up to the next conversion in one go
+    const char *pPercent = ::strchr(pText, '%');
+    if (pPercent == nullptr) {
+      append(pText);
+      break;
+    }
+    append(pText, pPercent - pText);
+
+    if (pPercent[1] == '%') {
+      push_back('%');
+      pText = pPercent + 2;
+      continue;
+    }
+
+    // Find the end of the conversion specification
+    const char *pSpecEnd = pPercent + 1;
+    while ((*pSpecEnd != '\0') && (::strchr("-+ #0123456789.hljztLq",
+                                             *pSpecEnd) != nullptr))
+      ++pSpecEnd;
+    if (*pSpecEnd == '\0') {
+      append(pPercent);
+      break;
+    }
+    const char cConv = *pSpecEnd++;
+    pText = pSpecEnd;
+
+    if (nArg >= vnArgs) {
+      assert(false && "FormatTyped() conversion has no argument");
+      append("%!");
+      push_back(cConv);
+      append("(MISSING)");
+      continue;
+    }
+    const SFormatArg &rArg = vpArgs[nArg++];
+    if (!IsFormatArgMatch(cConv, rArg)) {
+      assert(false && "FormatTyped() argument type does not suit conversion");
+      append("%!");
+      push_back(cConv);
+      append("(BADTYPE)");
+      continue;
+    }
+    AppendFormatArg(pPercent, pSpecEnd - pPercent, rArg);
+  }
+
+  if (nArg < vnArgs) {
+    assert(false && "FormatTyped() has more arguments than conversions");
+    append("%!(EXTRA)");
+  }
+}
+
+//++
+// Details: Check an argument is of a type a printf style conversion takes.
+//          Integer conversions take integers of either signedness, %s takes
+//          strings, %p takes pointers and strings and the floating point
+//          conversions take doubles.
+// Type:    Static method.
+// Args:    vcConv  - (R) The conversion character, i.e. 'd' for "%lld".
+//          vrArg   - (R) The argument.
+// Return:  bool - True = the conversion takes the argument, false = not.
+// Throws:  None.
+//--
+bool CMIUtilString::IsFormatArgMatch(const char vcConv,
+                                     const SFormatArg &vrArg) {
+  switch (vcConv) {
+  case 'd':
+  case 'i':
+  case 'u':
+  case 'o':
+  case 'x':
+  case 'X':
+  case 'c':
+    return (vrArg.m_eType == SFormatArg::eType_Signed) ||
+           (vrArg.m_eType == SFormatArg::eType_Unsigned);
+  case 's':
+    return vrArg.m_eType == SFormatArg::eType_String;
+  case 'p':
+    return (vrArg.m_eType == SFormatArg::eType_Pointer) ||
+           (vrArg.m_eType == SFormatArg::eType_String);
+  case 'f':
+  case 'F':
+  case 'e':
+  case 'E':
+  case 'g':
+  case 'G':
+  case 'a':
+  case 'A':
+    return vrArg.m_eType == SFormatArg::eType_Double;
+  default:
+    return false;
+  }
+}
+
+//++
+// Details: Format one argument as directed by one printf style conversion
+//          specification and append the text to *this string. Numbers are
+//          converted by hand into a buffer on the stack, only floating point
+//          is passed on to snprintf().
+// Type:    Method.
+// Args:    vpSpec      - (R) The conversion specification, starting at '%'.
+//          vnSpecLen   - (R) Length of the specification.
+//          vrArg       - (R) The argument.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilString::AppendFormatArg(const char *vpSpec, const size_t vnSpecLen,
+                                    const SFormatArg &vrArg) {
+  const char cConv = vpSpec[vnSpecLen - 1];
+  bool bLeft = false;
+  bool bPlus = false;
+  bool bSpace = false;
+  bool bAlt = false;
+  bool bZero = false;
+  size_t nWidth = 0;
+  size_t nPrecision = 0;
+  bool bHavePrecision = false;
+  // With no length modifier an integer is taken as an int, as printf does
+  MIuint nLenBits = sizeof(int) * CHAR_BIT;
+
+  // Parse flags, width, precision and length modifier
+  const char *p = vpSpec + 1;
+  const char *pEnd = vpSpec + vnSpecLen - 1;
+  for (; (p < pEnd) && (::strchr("-+ #0", *p) != nullptr); ++p) {
+    switch (*p) {
+    case '-':
+      bLeft = true;
+      break;
+    case '+':
+      bPlus = true;
+      break;
+    case ' ':
+      bSpace = true;
+      break;
+    case '#':
+      bAlt = true;
+      break;
+    default:
+      bZero = true;
+      break;
+    }
+  }
+  for (; (p < pEnd) && (*p >= '0') && (*p <= '9'); ++p)
+    nWidth = nWidth * 10 + (*p - '0');
+  if ((p < pEnd) && (*p == '.')) {
+    bHavePrecision = true;
+    for (++p; (p < pEnd) && (*p >= '0') && (*p <= '9'); ++p)
+      nPrecision = nPrecision * 10 + (*p - '0');
+  }
+  if ((p + 1 < pEnd) && (p[0] == 'h') && (p[1] == 'h'))
+    nLenBits = sizeof(char) * CHAR_BIT;
+  else if ((p < pEnd) && (p[0] == 'h'))
+    nLenBits = sizeof(short) * CHAR_BIT;
+  else if ((p + 1 < pEnd) && (p[0] == 'l') && (p[1] == 'l'))
+    nLenBits = sizeof(long long) * CHAR_BIT;
+  else if ((p < pEnd) && (p[0] == 'l'))
+    nLenBits = sizeof(long) * CHAR_BIT;
+  else if ((p < pEnd) && (::strchr("jztLq", p[0]) != nullptr))
+    nLenBits = 64;
+
+  if ((cConv == 'f') || (cConv == 'F') || (cConv == 'e') || (cConv == 'E') ||
+      (cConv == 'g') || (cConv == 'G') || (cConv == 'a') || (cConv == 'A')) {
+    // Rebuild the specification without any length modifier for a double
+    char spec[32];
+    const size_t nSpecLen = std::min<size_t>(p - vpSpec, sizeof(spec) - 2);
+    ::memcpy(spec, vpSpec, nSpecLen);
+    spec[nSpecLen] = cConv;
+    spec[nSpecLen + 1] = '\0';
+    const double dValue = vrArg.m_dValue;
+    char buffer[128];
+    const int n = ::snprintf(buffer, sizeof(buffer), spec, dValue);
+    if (n < 0)
+      return;
+    if (static_cast<size_t>(n) < sizeof(buffer))
+      append(buffer, n);
+    else {
+      const size_t nStart = size();
+      resize(nStart + n);
+      ::snprintf(&(*this)[nStart], n + 1, spec, dValue);
+    }
+    return;
+  }
+
+  // Work out the text of the value itself plus any sign or base prefix
+  char digits[72];
+  char *pDigitsEnd = digits + sizeof(digits);
+  char *pDigits = pDigitsEnd;
+  const char *pPrefix = "";
+  const char *pBody = nullptr;
+  size_t nBodyLen = 0;
+  bool bNumeric = true;
+
+  if (cConv == 's') {
+    bNumeric = false;
+    pBody = vrArg.m_pText;
+    nBodyLen = vrArg.m_nTextLen;
+    if (pBody == nullptr) {
+      pBody = "(null)";
+      nBodyLen = 6;
+    }
+    if (bHavePrecision && (nPrecision < nBodyLen))
+      nBodyLen = nPrecision;
+  } else if (cConv == 'c') {
+    bNumeric = false;
+    *--pDigits = static_cast<char>(vrArg.m_nUnsigned);
+    pBody = pDigits;
+    nBodyLen = 1;
+  } else if (cConv == 'p') {
+    MIuint64 nValue = reinterpret_cast<uintptr_t>(vrArg.m_pData);
+    if (nValue == 0) {
+      bNumeric = false;
+      pBody = "(nil)";
+      nBodyLen = 5;
+    } else {
+      do {
+        *--pDigits = "0123456789abcdef"[nValue & 0xf];
+        nValue >>= 4;
+      } while (nValue != 0);
+      pPrefix = "0x";
+    }
+  } else {
+    // Integer conversions, the argument's own type decides signedness
+    MIuint64 nValue = vrArg.m_nUnsigned;
+    bool bNegative = false;
+    const bool bSignedConv = (cConv == 'd') || (cConv == 'i');
+    if (nLenBits < 64) {
+      const MIuint64 nMask = (static_cast<MIuint64>(1) << nLenBits) - 1;
+      nValue &= nMask;
+      // Sign extend a truncated value for a signed conversion
+      if (bSignedConv &&
+          (nValue & (static_cast<MIuint64>(1) << (nLenBits - 1))))
+        nValue |= ~nMask;
+    }
+    if (bSignedConv && ((nValue >> 63) != 0)) {
+      bNegative = true;
+      nValue = 0 - nValue;
+    }
+
+    const bool bZeroValue = (nValue == 0);
+    if ((cConv == 'x') || (cConv == 'X')) {
+      const char *pHex =
+          (cConv == 'x') ? "0123456789abcdef" : "0123456789ABCDEF";
+      while (nValue != 0) {
+        *--pDigits = pHex[nValue & 0xf];
+        nValue >>= 4;
+      }
+      if (bAlt && !bZeroValue)
+        pPrefix = (cConv == 'x') ? "0x" : "0X";
+    } else if (cConv == 'o') {
+      while (nValue != 0) {
+        *--pDigits = static_cast<char>('0' + (nValue & 7));
+        nValue >>= 3;
+      }
+      if (bAlt)
+        *--pDigits = '0';
+    } else {
+      while (nValue != 0) {
+        *--pDigits = static_cast<char>('0' + (nValue % 10));
+        nValue /= 10;
+      }
+    }
+    // A zero value prints one digit unless an explicit precision of 0 is given
+    if ((pDigits == pDigitsEnd) && !(bHavePrecision && (nPrecision == 0)) &&
+        !((cConv == 'o') && bAlt))
+      *--pDigits = '0';
+
+    if (bSignedConv) {
+      if (bNegative)
+        pPrefix = "-";
+      else if (bPlus)
+        pPrefix = "+";
+      else if (bSpace)
+        pPrefix = " ";
+    }
+  }
+
+  if (pBody == nullptr) {
+    pBody = pDigits;
+    nBodyLen = pDigitsEnd - pDigits;
+  }
+
+  // Work out the padding
+  const size_t nPrefixLen = ::strlen(pPrefix);
+  size_t nZeros = 0;
+  if (bNumeric) {
+    if (bHavePrecision && (nPrecision > nBodyLen))
+      nZeros = nPrecision - nBodyLen;
+    else if (bZero && !bLeft && !bHavePrecision &&
+             (nWidth > nPrefixLen + nBodyLen))
+      nZeros = nWidth - nPrefixLen - nBodyLen;
+  }
+  const size_t nTotal = nPrefixLen + nZeros + nBodyLen;
+  const size_t nPad = (nWidth > nTotal) ? nWidth - nTotal : 0;
+
+  if (!bLeft && (nPad > 0))
+    append(nPad, ' ');
+  append(pPrefix, nPrefixLen);
+  if (nZeros > 0)
+    append(nZeros, '0');
+  append(pBody, nBodyLen);
+  if (bLeft && (nPad > 0))
+    append(nPad, ' ');
+}
+
 //++
 // Details: Splits string into array of strings using delimiter. If multiple
 // delimiter
@@ -730,17 +1213,24 @@ size_t CMIUtilString::FindFirstQuote(size_t vnPos) const {
 // Throws:  None.
 //--
 CMIUtilString CMIUtilString::Escape(bool vbEscapeQuotes /* = false */) const {
-  const size_t nLen(length());
-  CMIUtilString strNew;
-  strNew.reserve(nLen);
-  for (size_t nIndex(0); nIndex < nLen; ++nIndex) {
-    const char cUnescapedChar((*this)[nIndex]);
-    if (cUnescapedChar == '"' && vbEscapeQuotes)
-      strNew.append("\\\"");
-    else
-      strNew.append(ConvertToPrintableASCII((char)cUnescapedChar));
-  }
-  return strNew;
+  const bool bAddSlashes = false;
+  return EscapeText(*this, vbEscapeQuotes, bAddSlashes);
+}
+
+//++
+// Details: Get escaped string from *this string with backslashes then put in
+//          front of its double quote '"' and backslash '\\' characters, in
+//          one pass. Same as Escape().AddSlashes().
+// Type:    Method.
+// Args:    None.
+// Return:  CMIUtilString - The escaped and wrapped version of the initial
+//          string.
+// Throws:  None.
+//--
+CMIUtilString CMIUtilString::EscapeAndAddSlashes() const {
+  const bool bEscapeQuotes = false;
+  const bool bAddSlashes = true;
+  return EscapeText(*this, bEscapeQuotes, bAddSlashes);
 }
 
 //++
@@ -754,24 +1244,24 @@ CMIUtilString CMIUtilString::Escape(bool vbEscapeQuotes /* = false */) const {
 //--
 CMIUtilString CMIUtilString::AddSlashes() const {
   const char cBckSlash('\\');
+  const char *pText = data();
   const size_t nLen(length());
   CMIUtilString strNew;
-  strNew.reserve(nLen);
+  strNew.reserve(nLen + (nLen >> 4) + 2);
 
+  const bool bControl = false;
+  const bool bQuote = true;
   size_t nOffset(0);
   while (nOffset < nLen) {
-    const size_t nUnescapedCharPos(find_first_of("\"\\", nOffset));
-    const bool bUnescapedCharNotFound(nUnescapedCharPos == std::string::npos);
-    if (bUnescapedCharNotFound) {
-      const size_t nAppendAll(std::string::npos);
-      strNew.append(*this, nOffset, nAppendAll);
-      break;
-    }
+    const size_t nUnescapedCharPos(
+        nOffset + FindFirstCharToEscape(pText + nOffset, nLen - nOffset,
+                                        bControl, bQuote));
     const size_t nAppendLen(nUnescapedCharPos - nOffset);
-    strNew.append(*this, nOffset, nAppendLen);
+    strNew.append(pText + nOffset, nAppendLen);
+    if (nUnescapedCharPos == nLen)
+      break;
     strNew.push_back(cBckSlash);
-    const char cUnescapedChar((*this)[nUnescapedCharPos]);
-    strNew.push_back(cUnescapedChar);
+    strNew.push_back(pText[nUnescapedCharPos]);
     nOffset = nUnescapedCharPos + 1;
   }
 
@@ -821,35 +1311,10 @@ CMIUtilString CMIUtilString::StripSlashes() const {
 
 CMIUtilString CMIUtilString::ConvertToPrintableASCII(const char vChar,
                                                      bool bEscapeQuotes) {
-  switch (vChar) {
-  case '\a':
-    return "\\a";
-  case '\b':
-    return "\\b";
-  case '\t':
-    return "\\t";
-  case '\n':
-    return "\\n";
-  case '\v':
-    return "\\v";
-  case '\f':
-    return "\\f";
-  case '\r':
-    return "\\r";
-  case '\033':
-    return "\\e";
-  case '\\':
-    return "\\\\";
-  case '"':
-    if (bEscapeQuotes)
-      return "\\\"";
-    LLVM_FALLTHROUGH;
-  default:
-    if (::isprint(vChar))
-      return Format("%c", vChar);
-    else
-      return Format("\\x%02" PRIx8, vChar);
-  }
+  CMIUtilString strNew;
+  const bool bAddSlashes = false;
+  AppendEscapedChar(strNew, vChar, bEscapeQuotes, bAddSlashes);
+  return strNew;
 }
 
 CMIUtilString
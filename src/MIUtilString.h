@@ -11,7 +11,9 @@
 // Third party headers:
 #include <cinttypes>
 #include <cstdarg>
+#include <cstring>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // In-house headers:
@@ -27,6 +29,64 @@ class CMIUtilString : public std::string {
 public:
   typedef std::vector<CMIUtilString> VecString_t;
 
+  // Structs:
+public:
+  //++
+  // Details: One argument given to FormatTyped() or AppendFormat(). Only the
+  //          types below can be formatted, giving any other type is a compile
+  //          time error rather than undefined behaviour as with C varargs.
+  //--
+  struct SFormatArg {
+    enum Type_e {
+      eType_Signed,
+      eType_Unsigned,
+      eType_String,
+      eType_Pointer,
+      eType_Double
+    };
+
+    /* ctor */ SFormatArg() : m_eType(eType_Unsigned), m_nUnsigned(0) {}
+    template <typename T, typename = typename std::enable_if<
+                              std::is_integral<T>::value ||
+                              std::is_enum<T>::value>::type>
+    /* ctor */ SFormatArg(const T vValue) {
+      typedef typename std::conditional<std::is_enum<T>::value,
+                                        std::underlying_type<T>,
+                                        std::common_type<T>>::type::type
+          Int_t;
+      if (std::is_signed<Int_t>::value) {
+        m_eType = eType_Signed;
+        m_nSigned = static_cast<MIint64>(vValue);
+      } else {
+        m_eType = eType_Unsigned;
+        m_nUnsigned = static_cast<MIuint64>(vValue);
+      }
+    }
+    /* ctor */ SFormatArg(const double vValue)
+        : m_eType(eType_Double), m_dValue(vValue) {}
+    /* ctor */ SFormatArg(const char *vpText)
+        : m_eType(eType_String), m_pText(vpText),
+          m_nTextLen(vpText ? ::strlen(vpText) : 0) {}
+    /* ctor */ SFormatArg(const std::string &vrText)
+        : m_eType(eType_String), m_pText(vrText.c_str()),
+          m_nTextLen(vrText.length()) {}
+    /* ctor */ SFormatArg(char *vpText)
+        : SFormatArg(const_cast<const char *>(vpText)) {}
+    template <typename T>
+    /* ctor */ SFormatArg(T *vpData)
+        : m_eType(eType_Pointer), m_pData(vpData) {}
+
+    Type_e m_eType;
+    union {
+      MIint64 m_nSigned;
+      MIuint64 m_nUnsigned;
+      double m_dValue;
+      const char *m_pText;
+      const void *m_pData;
+    };
+    size_t m_nTextLen = 0;
+  };
+
   // Static method:
 public:
   static CMIUtilString Format(const char *vFormating, ...);
@@ -44,6 +104,9 @@ public:
                                                bool bEscapeQuotes = false);
   static CMIUtilString ConvertToPrintableASCII(const char32_t vChar32,
                                                bool bEscapeQuotes = false);
+  template <typename... Args>
+  static CMIUtilString FormatTyped(const char *vpFormat,
+                                   const Args &... vrArgs);
 
   // Methods:
 public:
@@ -72,7 +135,10 @@ public:
   size_t FindFirstNot(const CMIUtilString &vrPattern, size_t vnPos = 0) const;
   CMIUtilString Escape(bool vbEscapeQuotes = false) const;
   CMIUtilString AddSlashes() const;
+  CMIUtilString EscapeAndAddSlashes() const;
   CMIUtilString StripSlashes() const;
+  template <typename... Args>
+  CMIUtilString &AppendFormat(const char *vpFormat, const Args &... vrArgs);
   //
   CMIUtilString &operator=(const char *vpRhs);
   CMIUtilString &operator=(const std::string &vrRhs);
@@ -86,10 +152,56 @@ private:
   static CMIUtilString FormatPriv(const CMIUtilString &vrFormat, va_list vArgs);
   static CMIUtilString ConvertCharValueToPrintableASCII(char vChar,
                                                         bool bEscapeQuotes);
+  static bool IsFormatArgMatch(const char vcConv, const SFormatArg &vrArg);
 
   // Methods:
 private:
+  void AppendFormatPriv(const char *vpFormat, const SFormatArg *vpArgs,
+                        const size_t vnArgs);
+  void AppendFormatArg(const char *vpSpec, const size_t vnSpecLen,
+                       const SFormatArg &vrArg);
   bool ExtractNumberFromHexadecimal(MIint64 &vwrNumber) const;
   CMIUtilString RemoveRepeatedCharacters(size_t vnPos, const char vChar);
   size_t FindFirstQuote(size_t vnPos) const;
 };
+
+//++
+// Details: Perform a printf style format of the arguments and return the text
+//          as a new string. Unlike Format() the arguments keep their type so
+//          strings (including CMIUtilString) and integers of any width can be
+//          given for %s, %d, %u, %x etc. without casts, and no temporary heap
+//          buffer is used. Supported conversions are d i u o x X c s p f F e
+//          E g G and %%, with flags, width, precision and length modifiers.
+//          The number and types of the arguments must match the format, see
+//          AppendFormatPriv() for what happens when they do not.
+// Type:    Static method.
+// Args:    vpFormat    - (R) Format string data instruction.
+//          vrArgs      - (R) The arguments.
+// Return:  CMIUtilString - The formatted text.
+// Throws:  None.
+//--
+template <typename... Args>
+CMIUtilString CMIUtilString::FormatTyped(const char *vpFormat,
+                                         const Args &... vrArgs) {
+  CMIUtilString strResult;
+  strResult.AppendFormat(vpFormat, vrArgs...);
+  return strResult;
+}
+
+//++
+// Details: Perform a printf style format of the arguments, see FormatTyped(),
+//          appending the text to *this string.
+// Type:    Method.
+// Args:    vpFormat    - (R) Format string data instruction.
+//          vrArgs      - (R) The arguments.
+// Return:  CMIUtilString & - *this string.
+// Throws:  None.
+//--
+template <typename... Args>
+CMIUtilString &CMIUtilString::AppendFormat(const char *vpFormat,
+                                           const Args &... vrArgs) {
+  // Extra element so the array is never empty
+  const SFormatArg args[] = {SFormatArg(vrArgs)..., SFormatArg()};
+  AppendFormatPriv(vpFormat, args, sizeof...(Args));
+  return *this;
+}
@@ -222,6 +222,24 @@ bool CMIUtilThread::Join() {
   return MIstatus::success;
 }
 
+//++
+// Details: Let the thread run on without waiting for it to stop, i.e. when it
+//          is blocked in a read that may never return. The thread must not
+//          touch anything that is destroyed before the application exits.
+// Type:    Method.
+// Args:    None.
+// Return:  None.
+// Throws:  None.
+//--
+void CMIUtilThread::Detach() {
+  CMIUtilThreadLock _lock(m_mutex);
+  if (m_pThread != nullptr) {
+    m_pThread->detach();
+    delete m_pThread;
+    m_pThread = nullptr;
+  }
+}
+
 //++
 // Details: Is the thread doing work.
 // Type:    Method.
@@ -55,6 +55,7 @@ public:
   //
   bool Start(FnThreadProc vpFn, void *vpArg); // Start execution of this thread
   bool Join();                                // Wait for this thread to stop
+  void Detach(); // Let this thread run on without waiting for it to stop
   bool IsActive(); // Returns true if this thread is running
   void Finish();   // Finish this thread
 
@@ -83,7 +84,8 @@ public:
   bool Release();        // Release a reference to this object
   bool ThreadIsActive(); // Return true if this object is running
   bool ThreadJoin();     // Wait for this thread to stop running
-  bool ThreadKill();     // Force this thread to stop, regardless of references
+  virtual bool ThreadKill(); // Force this thread to stop, regardless of
+                             // references
   bool ThreadExecute();  // Start this objects execution in another thread
   void ThreadManage();
 
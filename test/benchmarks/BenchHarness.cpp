@@ -0,0 +1,87 @@
+//===-- BenchHarness.cpp ----------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Runner for the in-tree benchmark harness, see BenchHarness.h. Each
+// benchmark is run with a doubling number of iterations until one run takes
+// long enough to time, then the time per iteration is reported.
+
+#include "BenchHarness.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace {
+typedef std::vector<std::unique_ptr<benchmark::internal::Benchmark>>
+    VecBenchmarks_t;
+
+VecBenchmarks_t &GetBenchmarks() {
+  static VecBenchmarks_t benchmarks;
+  return benchmarks;
+}
+
+void RunOne(const benchmark::internal::Benchmark &vrBenchmark,
+            const int64_t vnArg, const bool vbHasArg) {
+  const double nMinSecs = 0.2;
+  int64_t nIterations = 1;
+  for (;;) {
+    benchmark::State state(vnArg, nIterations);
+    const auto start = std::chrono::steady_clock::now();
+    vrBenchmark.m_pFn(state);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if ((elapsed.count() < nMinSecs) && (nIterations < (INT64_C(1) << 40))) {
+      nIterations *= 2;
+      continue;
+    }
+
+    std::string strName(vrBenchmark.m_strName);
+    if (vbHasArg)
+      strName += "/" + std::to_string(vnArg);
+    std::printf("%-40s %14.0f ns %12" PRId64, strName.c_str(),
+                elapsed.count() * 1e9 / nIterations, nIterations);
+    if (state.GetBytesProcessed() != 0)
+      std::printf(" bytes_per_second=%.1fM/s",
+                  state.GetBytesProcessed() / elapsed.count() / (1 << 20));
+    if (state.GetItemsProcessed() != 0)
+      std::printf(" items_per_second=%.1fk/s",
+                  state.GetItemsProcessed() / elapsed.count() / 1000);
+    std::printf("\n");
+    return;
+  }
+}
+} // namespace
+
+benchmark::internal::Benchmark *
+benchmark::internal::RegisterBenchmark(const char *vpName, Function vpFn) {
+  GetBenchmarks().emplace_back(new Benchmark(vpName, vpFn));
+  return GetBenchmarks().back().get();
+}
+
+// Usage: lldb-mi-bench [--benchmark_filter=<substring>]
+int main(int argc, char **argv) {
+  const char *pFilter = "";
+  const char *pOption = "--benchmark_filter=";
+  for (int i = 1; i < argc; ++i)
+    if (std::strncmp(argv[i], pOption, std::strlen(pOption)) == 0)
+      pFilter = argv[i] + std::strlen(pOption);
+
+  std::printf("%-40s %17s %12s\n", "Benchmark", "Time", "Iterations");
+  for (const auto &rBenchmark : GetBenchmarks()) {
+    if (rBenchmark->m_strName.find(pFilter) == std::string::npos)
+      continue;
+    if (rBenchmark->m_vecArgs.empty())
+      RunOne(*rBenchmark, 0, false);
+    for (const int64_t nArg : rBenchmark->m_vecArgs)
+      RunOne(*rBenchmark, nArg, true);
+  }
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+//===-- BenchHarness.h ------------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// lldb-mi-bench uses Google Benchmark when it is installed. Otherwise the
+// small subset of its interface used by the benchmarks is provided here so
+// the benchmarks still build and run.
+
+#pragma once
+
+#ifndef MI_BENCH_IN_TREE_HARNESS
+#include <benchmark/benchmark.h>
+#else
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+template <class T> inline void DoNotOptimize(T const &vValue) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(vValue) : "memory");
+#else
+  const volatile char *pSink = reinterpret_cast<const volatile char *>(&vValue);
+  (void)*pSink;
+#endif
+}
+
+template <class T> inline void DoNotOptimize(T &vValue) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : "+r,m"(vValue) : : "memory");
+#else
+  const volatile char *pSink = reinterpret_cast<const volatile char *>(&vValue);
+  (void)*pSink;
+#endif
+}
+
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+class State {
+public:
+  class Iterator {
+  public:
+    // Marked unused like the library's own so "for (auto _ : state)" loops
+    // do not warn
+#if defined(__GNUC__)
+    struct __attribute__((unused)) Value {};
+#else
+    struct Value {};
+#endif
+    explicit Iterator(int64_t vnLeft) : m_nLeft(vnLeft) {}
+    Value operator*() const { return Value(); }
+    Iterator &operator++() {
+      --m_nLeft;
+      return *this;
+    }
+    bool operator!=(const Iterator &) const { return m_nLeft > 0; }
+
+  private:
+    int64_t m_nLeft;
+  };
+
+  State(const int64_t vnRange, const int64_t vnIterations)
+      : m_nRange(vnRange), m_nIterations(vnIterations), m_nBytes(0),
+        m_nItems(0) {}
+  Iterator begin() const { return Iterator(m_nIterations); }
+  Iterator end() const { return Iterator(0); }
+  int64_t range(const size_t) const { return m_nRange; }
+  int64_t iterations() const { return m_nIterations; }
+  void SetBytesProcessed(const int64_t vnBytes) { m_nBytes = vnBytes; }
+  void SetItemsProcessed(const int64_t vnItems) { m_nItems = vnItems; }
+  int64_t GetBytesProcessed() const { return m_nBytes; }
+  int64_t GetItemsProcessed() const { return m_nItems; }
+
+private:
+  int64_t m_nRange;
+  int64_t m_nIterations;
+  int64_t m_nBytes;
+  int64_t m_nItems;
+};
+
+namespace internal {
+typedef void (*Function)(State &);
+
+class Benchmark {
+public:
+  Benchmark(const char *vpName, Function vpFn)
+      : m_strName(vpName), m_pFn(vpFn) {}
+  Benchmark *Arg(const int64_t vnArg) {
+    m_vecArgs.push_back(vnArg);
+    return this;
+  }
+
+  std::string m_strName;
+  Function m_pFn;
+  std::vector<int64_t> m_vecArgs;
+};
+
+Benchmark *RegisterBenchmark(const char *vpName, Function vpFn);
+} // namespace internal
+} // namespace benchmark
+
+#define MI_BENCH_CONCAT2(a, b) a##b
+#define MI_BENCH_CONCAT(a, b) MI_BENCH_CONCAT2(a, b)
+#define BENCHMARK(fn)                                                          \
+  static ::benchmark::internal::Benchmark *MI_BENCH_CONCAT(                    \
+      gBenchmark_, __LINE__) = ::benchmark::internal::RegisterBenchmark(#fn, fn)
+
+#endif // MI_BENCH_IN_TREE_HARNESS
@@ -0,0 +1,64 @@
+#include "BenchHarness.h"
+
+#include <MICmdArgSet.h>
+#include <MICmdArgValListOfN.h>
+#include <MICmdArgValNumber.h>
+#include <MICmdArgValOptionLong.h>
+#include <MICmdArgValString.h>
+
+// -break-delete with a list of N breakpoint numbers
+static void BM_ArgSetListOfNumbers(benchmark::State &state) {
+  CMIUtilString strOptions("--thread 1 --frame 0");
+  for (int64_t i = 0; i < state.range(0); ++i)
+    strOptions.AppendFormat(" %" PRId64, i + 1);
+  for (auto _ : state) {
+    CMICmdArgSet setCmdArgs;
+    setCmdArgs.Add(new CMICmdArgValOptionLong(
+        "thread", false, true, CMICmdArgValListBase::eArgValType_Number, 1));
+    setCmdArgs.Add(new CMICmdArgValOptionLong(
+        "frame", false, true, CMICmdArgValListBase::eArgValType_Number, 1));
+    setCmdArgs.Add(new CMICmdArgValListOfN(
+        "breakpoint", true, true, CMICmdArgValListBase::eArgValType_Number));
+    CMICmdArgContext argContext(strOptions);
+    benchmark::DoNotOptimize(setCmdArgs.Validate("break-delete", argContext));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArgSetListOfNumbers)->Arg(10)->Arg(1000)->Arg(10000);
+
+// -data-write-memory-bytes with N bytes of hex contents
+static void BM_ArgSetLongContents(benchmark::State &state) {
+  CMIUtilString strOptions("--thread 1 --frame 0 0x400000 \"");
+  strOptions.append(static_cast<size_t>(state.range(0)) * 2, 'a');
+  strOptions += "\" 16";
+  for (auto _ : state) {
+    CMICmdArgSet setCmdArgs;
+    setCmdArgs.Add(new CMICmdArgValOptionLong(
+        "thread", false, true, CMICmdArgValListBase::eArgValType_Number, 1));
+    setCmdArgs.Add(new CMICmdArgValOptionLong(
+        "frame", false, true, CMICmdArgValListBase::eArgValType_Number, 1));
+    setCmdArgs.Add(new CMICmdArgValString("address", true, true, false, true));
+    setCmdArgs.Add(new CMICmdArgValString("contents", true, true, true, true));
+    setCmdArgs.Add(new CMICmdArgValNumber("count", false, true));
+    CMICmdArgContext argContext(strOptions);
+    benchmark::DoNotOptimize(
+        setCmdArgs.Validate("data-write-memory-bytes", argContext));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArgSetLongContents)->Arg(10)->Arg(1000)->Arg(100000);
+
+// Split N arguments then consume them in order
+static void BM_ArgContextRemoveArgs(benchmark::State &state) {
+  CMIUtilString strOptions;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    strOptions.AppendFormat("arg%" PRId64 " ", i);
+  for (auto _ : state) {
+    CMICmdArgContext argContext(strOptions);
+    while (!argContext.IsEmpty())
+      argContext.RemoveArgAtPos(0);
+    benchmark::DoNotOptimize(argContext.IsEmpty());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArgContextRemoveArgs)->Arg(10)->Arg(1000)->Arg(10000);
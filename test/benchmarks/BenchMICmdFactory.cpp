@@ -0,0 +1,77 @@
+#include "BenchHarness.h"
+
+#include <MIUtilPerfectHash.h>
+#include <MIUtilString.h>
+
+#include <map>
+
+// CMICmdFactory needs the command classes, and so liblldb, to be created.
+// Its dispatch is a lookup of the command name in a perfect hash of the
+// command table, compared here with the map it used to keep.
+typedef void *(*CmdCreatorFnPtr)();
+typedef std::map<CMIUtilString, CmdCreatorFnPtr> MapMiCmdToCmdCreatorFn_t;
+
+// The names of the factory's command table
+static constexpr const char *gCommandNames[] = {
+#define MI_CMD(name, cmdClass) name,
+#include <MICmdCommands.def>
+};
+
+// What an IDE sends most while stepping
+static const char *const gCommandMix[] = {
+    "exec-next",         "stack-list-frames", "stack-list-variables",
+    "var-update",        "thread-info",       "var-list-children",
+    "var-create",        "data-read-memory-bytes", "var-delete",
+    "stack-info-depth"};
+
+static void *CreateNothing() { return nullptr; }
+
+constexpr CMIUtilPerfectHash<sizeof(gCommandNames) / sizeof(gCommandNames[0])>
+    gCommandHash(gCommandNames);
+static_assert(gCommandHash.IsValid(),
+              "Command listed twice or no perfect hash seed found");
+
+static std::vector<CMIUtilString> MakeCommandMix(const int64_t vnCount) {
+  const size_t nMix = sizeof(gCommandMix) / sizeof(gCommandMix[0]);
+  std::vector<CMIUtilString> vecCommands;
+  for (int64_t i = 0; i < vnCount; ++i)
+    vecCommands.push_back(gCommandMix[i % nMix]);
+  return vecCommands;
+}
+
+static void BM_FactoryDispatchMap(benchmark::State &state) {
+  MapMiCmdToCmdCreatorFn_t mapMiCmdToCmdCreatorFn;
+  for (const char *pName : gCommandNames)
+    mapMiCmdToCmdCreatorFn[pName] = &CreateNothing;
+  const std::vector<CMIUtilString> vecCommands =
+      MakeCommandMix(state.range(0));
+
+  for (auto _ : state) {
+    for (const CMIUtilString &rCmd : vecCommands) {
+      // CmdExist() then CmdCreate() as CMICmdInterpreter and CMICmdMgr did
+      if (mapMiCmdToCmdCreatorFn.find(rCmd) != mapMiCmdToCmdCreatorFn.end())
+        benchmark::DoNotOptimize(mapMiCmdToCmdCreatorFn.find(rCmd)->second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FactoryDispatchMap)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_FactoryDispatchPerfectHash(benchmark::State &state) {
+  CmdCreatorFnPtr apCreatorFn[sizeof(gCommandNames) / sizeof(gCommandNames[0])];
+  for (CmdCreatorFnPtr &rpFn : apCreatorFn)
+    rpFn = &CreateNothing;
+  const std::vector<CMIUtilString> vecCommands =
+      MakeCommandMix(state.range(0));
+
+  for (auto _ : state) {
+    for (const CMIUtilString &rCmd : vecCommands) {
+      // Resolved once by CMICmdInterpreter, carried to CMICmdFactory
+      const int nIndex = gCommandHash.Find(rCmd.c_str(), rCmd.size());
+      if (nIndex >= 0)
+        benchmark::DoNotOptimize(apCreatorFn[nIndex]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FactoryDispatchPerfectHash)->Arg(10)->Arg(1000)->Arg(100000);
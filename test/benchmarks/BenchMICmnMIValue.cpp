@@ -0,0 +1,90 @@
+#include "BenchHarness.h"
+
+#include <MICmnMIValueArena.h>
+#include <MICmnMIValueBuilder.h>
+#include <MICmnMIValueConst.h>
+#include <MICmnMIValueList.h>
+#include <MICmnMIValueResult.h>
+#include <MICmnMIValueTuple.h>
+
+// A frame tuple as -stack-list-frames forms it
+static CMICmnMIValueTuple MakeFrame(const MIuint vnLevel) {
+  const CMICmnMIValueConst miValueConst(
+      CMIUtilString::FormatTyped("%u", vnLevel));
+  const CMICmnMIValueResult miValueResult("level", miValueConst);
+  CMICmnMIValueTuple miValueTuple(miValueResult);
+  const CMICmnMIValueConst miValueConst2(
+      CMIUtilString::FormatTyped("0x%016" PRIx64, 0x400000ull + vnLevel));
+  const CMICmnMIValueResult miValueResult2("addr", miValueConst2);
+  miValueTuple.Add(miValueResult2);
+  const CMICmnMIValueConst miValueConst3("main");
+  const CMICmnMIValueResult miValueResult3("func", miValueConst3);
+  miValueTuple.Add(miValueResult3);
+  const CMICmnMIValueConst miValueConst4("/home/user/project/src/main.cpp");
+  const CMICmnMIValueResult miValueResult4("fullname", miValueConst4);
+  miValueTuple.Add(miValueResult4);
+  const CMICmnMIValueConst miValueConst5(CMIUtilString::FormatTyped("%u", 42u));
+  const CMICmnMIValueResult miValueResult5("line", miValueConst5);
+  miValueTuple.Add(miValueResult5);
+  return miValueTuple;
+}
+
+static void BM_ValueListOfFrames(benchmark::State &state) {
+  const MIuint nFrames = static_cast<MIuint>(state.range(0));
+  for (auto _ : state) {
+    CMICmnMIValueList miValueList(true);
+    for (MIuint i = 0; i < nFrames; ++i) {
+      const CMICmnMIValueResult miValueResult("frame", MakeFrame(i));
+      miValueList.Add(miValueResult);
+    }
+    benchmark::DoNotOptimize(miValueList.GetString());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueListOfFrames)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_ValueListOfFramesArena(benchmark::State &state) {
+  const MIuint nFrames = static_cast<MIuint>(state.range(0));
+  for (auto _ : state) {
+    // As the invoker does for each command
+    CMICmnMIValueArena arena;
+    const CMICmnMIValueArena::CScope arenaScope(&arena);
+    CMICmnMIValueList miValueList(true);
+    for (MIuint i = 0; i < nFrames; ++i) {
+      const CMICmnMIValueResult miValueResult("frame", MakeFrame(i));
+      miValueList.Add(miValueResult);
+    }
+    benchmark::DoNotOptimize(miValueList.GetString());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueListOfFramesArena)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_ValueBuilderListOfFrames(benchmark::State &state) {
+  const MIuint nFrames = static_cast<MIuint>(state.range(0));
+  for (auto _ : state) {
+    CMIUtilString text;
+    CMICmnMIValueBuilder builder(text);
+    builder.OpenList();
+    for (MIuint i = 0; i < nFrames; ++i) {
+      builder.Result("frame");
+      builder.OpenTuple();
+      builder.Result("level");
+      builder.Const(CMIUtilString::FormatTyped("%u", i));
+      builder.Result("addr");
+      builder.Const(
+          CMIUtilString::FormatTyped("0x%016" PRIx64, 0x400000ull + i));
+      builder.Result("func");
+      builder.Const("main");
+      builder.Result("fullname");
+      builder.Const("/home/user/project/src/main.cpp");
+      builder.Result("line");
+      builder.Const(CMIUtilString::FormatTyped("%u", 42u));
+      builder.CloseTuple();
+    }
+    builder.CloseList();
+    benchmark::DoNotOptimize(text);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ValueBuilderListOfFrames)->Arg(10)->Arg(1000)->Arg(100000);
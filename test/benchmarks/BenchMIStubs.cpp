@@ -0,0 +1,27 @@
+//===-- BenchMIStubs.cpp ----------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// The MI value and argument classes reach the logger and the stderr stream
+// through CMICmnBase and CMICmnResources. Their real implementations pull in
+// the driver and liblldb, lldb-mi-bench links these inert ones instead.
+
+#include "MICmnLog.h"
+#include "MICmnStreamStderr.h"
+
+CMICmnLog::CMICmnLog() : m_bEnabled(false), m_bInitializingATM(false) {}
+CMICmnLog::~CMICmnLog() {}
+bool CMICmnLog::Initialize() { return MIstatus::success; }
+bool CMICmnLog::Shutdown() { return MIstatus::success; }
+
+CMICmnStreamStderr::CMICmnStreamStderr() {}
+CMICmnStreamStderr::~CMICmnStreamStderr() {}
+bool CMICmnStreamStderr::Initialize() { return MIstatus::success; }
+bool CMICmnStreamStderr::Shutdown() { return MIstatus::success; }
+bool CMICmnStreamStderr::Write(const CMIUtilString &, const bool) {
+  return MIstatus::success;
+}
@@ -0,0 +1,73 @@
+#include "BenchHarness.h"
+
+#include <MIUtilEncode.h>
+
+#include <vector>
+
+static std::vector<unsigned char> MakeMemory(const size_t vnLen) {
+  std::vector<unsigned char> data(vnLen);
+  for (size_t i = 0; i < vnLen; ++i)
+    data[i] = static_cast<unsigned char>(i * 31 + (i >> 8));
+  return data;
+}
+
+static void BM_HexFormatPerByte(benchmark::State &state) {
+  const std::vector<unsigned char> data(MakeMemory(state.range(0)));
+  for (auto _ : state) {
+    CMIUtilString text;
+    text.reserve(data.size() * 2);
+    for (const unsigned char byte : data)
+      text.AppendFormat("%02hhx", byte);
+    benchmark::DoNotOptimize(text);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HexFormatPerByte)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+
+static void BM_HexEncode(benchmark::State &state) {
+  const std::vector<unsigned char> data(MakeMemory(state.range(0)));
+  for (auto _ : state) {
+    CMIUtilString text;
+    CMIUtilEncode::AppendHex(text, data.data(), data.size());
+    benchmark::DoNotOptimize(text);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HexEncode)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+
+static void BM_HexDecode(benchmark::State &state) {
+  const std::vector<unsigned char> data(MakeMemory(state.range(0)));
+  CMIUtilString text;
+  CMIUtilEncode::AppendHex(text, data.data(), data.size());
+  std::vector<unsigned char> decoded(data.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        CMIUtilEncode::DecodeHex(text.c_str(), text.size(), decoded.data()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HexDecode)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+
+static void BM_Base64Encode(benchmark::State &state) {
+  const std::vector<unsigned char> data(MakeMemory(state.range(0)));
+  for (auto _ : state) {
+    CMIUtilString text;
+    CMIUtilEncode::AppendBase64(text, data.data(), data.size());
+    benchmark::DoNotOptimize(text);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64Encode)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+
+static void BM_RunLengthEncodeZeroPage(benchmark::State &state) {
+  std::vector<unsigned char> data(state.range(0), 0);
+  data[data.size() / 2] = 1;
+  for (auto _ : state) {
+    CMIUtilString text;
+    CMIUtilEncode::AppendRunLength(text, data.data(), data.size());
+    benchmark::DoNotOptimize(text);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunLengthEncodeZeroPage)->Arg(4 << 10)->Arg(64 << 10);
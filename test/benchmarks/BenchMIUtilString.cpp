@@ -0,0 +1,121 @@
+#include "BenchHarness.h"
+
+#include <MIUtilString.h>
+
+static void BM_FormatInt(benchmark::State &state) {
+  int n = 0;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CMIUtilString::Format("%d", n++));
+}
+BENCHMARK(BM_FormatInt);
+
+static void BM_FormatTypedInt(benchmark::State &state) {
+  int n = 0;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CMIUtilString::FormatTyped("%d", n++));
+}
+BENCHMARK(BM_FormatTypedInt);
+
+static void BM_FormatAddress(benchmark::State &state) {
+  MIuint64 addr = 0x7fff5fbff8a0;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CMIUtilString::Format("0x%016" PRIx64, addr++));
+}
+BENCHMARK(BM_FormatAddress);
+
+static void BM_FormatTypedAddress(benchmark::State &state) {
+  MIuint64 addr = 0x7fff5fbff8a0;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        CMIUtilString::FormatTyped("0x%016" PRIx64, addr++));
+}
+BENCHMARK(BM_FormatTypedAddress);
+
+static void BM_FormatVarName(benchmark::State &state) {
+  const CMIUtilString parent("var12.child");
+  const CMIUtilString member("m_member");
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        CMIUtilString::Format("%s.%s", parent.c_str(), member.c_str()));
+}
+BENCHMARK(BM_FormatVarName);
+
+static void BM_FormatTypedVarName(benchmark::State &state) {
+  const CMIUtilString parent("var12.child");
+  const CMIUtilString member("m_member");
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        CMIUtilString::FormatTyped("%s.%s", parent, member));
+}
+BENCHMARK(BM_FormatTypedVarName);
+
+static CMIUtilString MakeValueText(const size_t vnLen) {
+  CMIUtilString text;
+  while (text.size() < vnLen)
+    text += "a \"quoted\" path C:\\dir\\file\tline\n";
+  text.resize(vnLen);
+  return text;
+}
+
+static void BM_Escape(benchmark::State &state) {
+  const CMIUtilString text(MakeValueText(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(text.Escape());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Escape)->Arg(64)->Arg(4096);
+
+static void BM_EscapeAddSlashes(benchmark::State &state) {
+  const CMIUtilString text(MakeValueText(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(text.Escape().AddSlashes());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EscapeAddSlashes)->Arg(64)->Arg(4096);
+
+static void BM_EscapeAndAddSlashes(benchmark::State &state) {
+  const CMIUtilString text(MakeValueText(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(text.EscapeAndAddSlashes());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EscapeAndAddSlashes)->Arg(64)->Arg(4096);
+
+static CMIUtilString MakeFields(const int64_t vnCount) {
+  CMIUtilString text;
+  for (int64_t i = 0; i < vnCount; ++i)
+    text.AppendFormat("%s\"field %" PRId64 "\"", (i != 0) ? " " : "", i);
+  return text;
+}
+
+static void BM_Split(benchmark::State &state) {
+  const CMIUtilString text(MakeFields(state.range(0)));
+  for (auto _ : state) {
+    CMIUtilString::VecString_t vecSplits;
+    benchmark::DoNotOptimize(text.Split(" ", vecSplits));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Split)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_SplitConsiderQuotes(benchmark::State &state) {
+  const CMIUtilString text(MakeFields(state.range(0)));
+  for (auto _ : state) {
+    CMIUtilString::VecString_t vecSplits;
+    benchmark::DoNotOptimize(text.SplitConsiderQuotes(" ", vecSplits));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SplitConsiderQuotes)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_SplitLines(benchmark::State &state) {
+  CMIUtilString text;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    text.AppendFormat("line %" PRId64 "\n", i);
+  for (auto _ : state) {
+    CMIUtilString::VecString_t vecSplits;
+    benchmark::DoNotOptimize(text.SplitLines(vecSplits));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SplitLines)->Arg(10)->Arg(1000)->Arg(100000);
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <MICmdArgContext.h>
+
+TEST(TestMICmdArgContext, SplitsArgumentsOnSpaces) {
+  CMICmdArgContext context("  --thread 1   --frame 0 ");
+  ASSERT_EQ(4u, context.GetNumberArgsPresent());
+  EXPECT_EQ("--thread", context.GetArg(0));
+  EXPECT_EQ("1", context.GetArg(1));
+  EXPECT_EQ("--frame", context.GetArg(2));
+  EXPECT_EQ("0", context.GetArg(3));
+  EXPECT_EQ("--thread 1 --frame 0", context.GetArgsLeftToParse());
+}
+
+TEST(TestMICmdArgContext, KeepsQuotedTextTogether) {
+  CMICmdArgContext context("a \"b c\" \"d \\\" e\" f\\ g");
+  ASSERT_EQ(5u, context.GetNumberArgsPresent());
+  EXPECT_EQ("a", context.GetArg(0));
+  EXPECT_EQ("\"b c\"", context.GetArg(1));
+  EXPECT_EQ("\"d \\\" e\"", context.GetArg(2));
+  EXPECT_EQ("f\\", context.GetArg(3));
+  EXPECT_EQ("g", context.GetArg(4));
+}
+
+TEST(TestMICmdArgContext, UnmatchedQuoteHasNoArguments) {
+  CMICmdArgContext context("a \"b c");
+  EXPECT_EQ(0u, context.GetNumberArgsPresent());
+  EXPECT_FALSE(context.IsEmpty());
+  EXPECT_FALSE(context.RemoveArgAtPos(0));
+  EXPECT_EQ("a \"b c", context.GetArgsLeftToParse());
+}
+
+TEST(TestMICmdArgContext, RemovesArgumentsByPosition) {
+  CMICmdArgContext context("a b c d");
+  EXPECT_TRUE(context.RemoveArgAtPos(2));
+  EXPECT_TRUE(context.RemoveArgAtPos(0));
+  EXPECT_FALSE(context.RemoveArgAtPos(2));
+  ASSERT_EQ(2u, context.GetNumberArgsPresent());
+  EXPECT_EQ("b", context.GetArg(0));
+  EXPECT_EQ("d", context.GetArg(1));
+  EXPECT_TRUE(context.RemoveArgAtPos(1));
+  EXPECT_TRUE(context.RemoveArgAtPos(0));
+  EXPECT_TRUE(context.IsEmpty());
+  EXPECT_EQ("", context.GetArgsLeftToParse());
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <MICmdArgSet.h>
+#include <MICmdArgValConsume.h>
+#include <MICmdArgValListOfN.h>
+#include <MICmdArgValNumber.h>
+#include <MICmdArgValOptionLong.h>
+#include <MICmdArgValString.h>
+#include <MICmnLog.h>
+#include <MICmnMIValueList.h>
+#include <MICmnStreamStderr.h>
+
+// CMICmdArgSet logs and reports errors, neither is wanted here
+CMICmnLog::CMICmnLog() : m_bEnabled(false), m_bInitializingATM(false) {}
+CMICmnLog::~CMICmnLog() {}
+bool CMICmnLog::Initialize() { return MIstatus::success; }
+bool CMICmnLog::Shutdown() { return MIstatus::success; }
+
+CMICmnStreamStderr::CMICmnStreamStderr() {}
+CMICmnStreamStderr::~CMICmnStreamStderr() {}
+bool CMICmnStreamStderr::Initialize() { return MIstatus::success; }
+bool CMICmnStreamStderr::Shutdown() { return MIstatus::success; }
+bool CMICmnStreamStderr::Write(const CMIUtilString &, const bool) {
+  return MIstatus::success;
+}
+
+// The arguments of -var-list-children
+static void AddArgs(CMICmdArgSet &vwrArgSet) {
+  vwrArgSet.Add(new CMICmdArgValOptionLong(
+      "thread", false, true, CMICmdArgValListBase::eArgValType_Number, 1));
+  vwrArgSet.Add(new CMICmdArgValConsume("--", false));
+  vwrArgSet.Add(new CMICmdArgValString(CMIUtilString("name"), true, true));
+  vwrArgSet.Add(new CMICmdArgValNumber("from", false, true));
+  vwrArgSet.Add(new CMICmdArgValNumber("to", false, true));
+}
+
+static bool Validate(CMICmdArgSet &vwrArgSet, const char *vpText) {
+  CMICmdArgContext context(vpText);
+  return vwrArgSet.Validate("var-list-children", context);
+}
+
+template <class T>
+static T *GetArg(const CMICmdArgSet &vrArgSet, const char *vpName) {
+  CMICmdArgValBase *pArg = nullptr;
+  if (!vrArgSet.GetArg(vpName, pArg))
+    return nullptr;
+  return static_cast<T *>(pArg);
+}
+
+TEST(TestMICmdArgSet, ResetReusesArguments) {
+  CMICmdArgSet argSet;
+  AddArgs(argSet);
+  const CMICmdArgSet::SetCmdArgs_t vecArgs(argSet.GetArgs());
+
+  ASSERT_TRUE(Validate(argSet, "--thread 2 var1 0 10"));
+  MIuint64 nThread = 0;
+  EXPECT_TRUE(GetArg<CMICmdArgValOptionLong>(argSet, "thread")
+                  ->GetExpectedOption<CMICmdArgValNumber>(nThread));
+  EXPECT_EQ(2u, nThread);
+  EXPECT_EQ("var1", GetArg<CMICmdArgValString>(argSet, "name")->GetValue());
+  EXPECT_EQ(10u, GetArg<CMICmdArgValNumber>(argSet, "to")->GetValue());
+
+  // The same argument objects parse the next command's options and keep
+  // nothing from the last ones
+  argSet.Reset();
+  ASSERT_TRUE(Validate(argSet, "var2"));
+  EXPECT_EQ(vecArgs, argSet.GetArgs());
+  EXPECT_FALSE(GetArg<CMICmdArgValOptionLong>(argSet, "thread")->GetFound());
+  EXPECT_TRUE(GetArg<CMICmdArgValOptionLong>(argSet, "thread")
+                  ->GetExpectedOptions()
+                  .empty());
+  EXPECT_EQ("var2", GetArg<CMICmdArgValString>(argSet, "name")->GetValue());
+  EXPECT_FALSE(GetArg<CMICmdArgValNumber>(argSet, "from")->GetFound());
+  EXPECT_FALSE(GetArg<CMICmdArgValNumber>(argSet, "to")->GetFound());
+
+  // A failed parse is forgotten too
+  argSet.Reset();
+  EXPECT_FALSE(Validate(argSet, "--thread"));
+  argSet.Reset();
+  EXPECT_TRUE(Validate(argSet, "var3 1 2"));
+  EXPECT_TRUE(argSet.GetArgsThatAreMissing().empty());
+  EXPECT_TRUE(argSet.GetArgsThatInvalid().empty());
+  EXPECT_EQ(1u, GetArg<CMICmdArgValNumber>(argSet, "from")->GetValue());
+}
+
+TEST(TestMICmdArgSet, TakeMovesArguments) {
+  CMICmdArgSet argSetFirst;
+  AddArgs(argSetFirst);
+  ASSERT_TRUE(Validate(argSetFirst, "var1 0 10"));
+  const CMICmdArgSet::SetCmdArgs_t vecArgs(argSetFirst.GetArgs());
+
+  CMICmdArgSet argSetNext;
+  argSetNext.Take(argSetFirst);
+  EXPECT_EQ(0u, argSetFirst.GetCount());
+  EXPECT_EQ(vecArgs, argSetNext.GetArgs());
+  EXPECT_FALSE(GetArg<CMICmdArgValString>(argSetNext, "name")->GetFound());
+  ASSERT_TRUE(Validate(argSetNext, "var2"));
+  EXPECT_EQ("var2", GetArg<CMICmdArgValString>(argSetNext, "name")->GetValue());
+}
+
+TEST(TestMICmdArgSet, GivesArgumentsAsMIList) {
+  CMICmdArgSet argSet;
+  AddArgs(argSet);
+  argSet.Add(new CMICmdArgValListOfN("values", false, true,
+                                     CMICmdArgValListBase::eArgValType_String));
+
+  CMICmnMIValueList miValueList(true);
+  argSet.GetArgsMIList(miValueList);
+  EXPECT_EQ("[{name=\"thread\",kind=\"long-option\",mandatory=\"false\","
+            "value-kind=\"number\"},"
+            "{name=\"--\",kind=\"consume\",mandatory=\"false\"},"
+            "{name=\"name\",kind=\"string\",mandatory=\"true\"},"
+            "{name=\"from\",kind=\"number\",mandatory=\"false\"},"
+            "{name=\"to\",kind=\"number\",mandatory=\"false\"},"
+            "{name=\"values\",kind=\"list\",mandatory=\"false\","
+            "value-kind=\"string\"}]",
+            miValueList.GetString());
+}
@@ -89,3 +89,28 @@ TEST(TestMICmdArgValString, HandlesNumbersIfNeeded) {
   context = CMICmdArgContext("10");
   EXPECT_FALSE(arg.Validate(context));
 }
+
+TEST(TestMICmdArgValString, HandlesLongQuotedString) {
+  CMICmdArgValString arg("arg", true, true, true, false, false);
+
+  const std::string contents(1 << 20, 'a');
+  CMICmdArgContext context("\"" + contents + "\" 16");
+  EXPECT_TRUE(arg.Validate(context));
+  EXPECT_EQ(contents, arg.GetValue());
+}
+
+TEST(TestMICmdArgValString, ParsesAgainAfterReset) {
+  CMICmdArgValString arg("arg", true, true);
+  CMICmdArgContext context("first");
+  EXPECT_TRUE(arg.Validate(context));
+  EXPECT_EQ("first", arg.GetValue());
+
+  arg.Reset();
+  EXPECT_FALSE(arg.GetFound());
+  EXPECT_TRUE(arg.GetValue().empty());
+
+  context = CMICmdArgContext("second");
+  EXPECT_TRUE(arg.Validate(context));
+  EXPECT_EQ("second", arg.GetValue());
+  EXPECT_STREQ("string", arg.GetKind());
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <MICmnLog.h>
+#include <MICmnStreamStderr.h>
+#include <MIDriverCmdReader.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// The reader logs and reports errors, neither is wanted here
+CMICmnLog::CMICmnLog() : m_bEnabled(false), m_bInitializingATM(false) {}
+CMICmnLog::~CMICmnLog() {}
+bool CMICmnLog::Initialize() { return MIstatus::success; }
+bool CMICmnLog::Shutdown() { return MIstatus::success; }
+
+CMICmnStreamStderr::CMICmnStreamStderr() {}
+CMICmnStreamStderr::~CMICmnStreamStderr() {}
+bool CMICmnStreamStderr::Initialize() { return MIstatus::success; }
+bool CMICmnStreamStderr::Shutdown() { return MIstatus::success; }
+bool CMICmnStreamStderr::Write(const CMIUtilString &, const bool) {
+  return MIstatus::success;
+}
+
+namespace {
+// Input giving the lines it is given, waiting for them, in place of stdin
+// and the command interpreter
+class CFakeInput : public CMIDriverCmdReader::IInput {
+public:
+  CFakeInput()
+      : m_nReads(0), m_nInterprets(0), m_bEndOfInput(false),
+        m_nInterpretDelayMs(0), m_bInterpretDone(false) {}
+
+  void Give(const char *vpLine) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queueLines.push_back(vpLine);
+    m_condition.notify_all();
+  }
+
+  void End() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bEndOfInput = true;
+    m_condition.notify_all();
+  }
+
+  // Wait for the reader to have asked for a number of lines
+  bool WaitForReads(const int vnReads) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_condition.wait_for(lock, std::chrono::seconds(10),
+                                [&] { return m_nReads >= vnReads; });
+  }
+
+  const char *ReadCmdLine(CMIUtilString &vwErrMsg,
+                          bool &vwbEndOfInput) override {
+    vwErrMsg.clear();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    ++m_nReads;
+    m_condition.notify_all();
+    m_condition.wait(lock,
+                     [this] { return !m_queueLines.empty() || m_bEndOfInput; });
+    if (m_queueLines.empty()) {
+      vwbEndOfInput = true;
+      return nullptr;
+    }
+    m_strLine = m_queueLines.front();
+    m_queueLines.pop_front();
+    return m_strLine.c_str();
+  }
+
+  void InterpretCmdLine(const CMIUtilString &vTextLine,
+                        CMIDriverCmdReader::SCmd &vwCmd) override {
+    ++m_nInterprets;
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(m_nInterpretDelayMs));
+    vwCmd.strMiTextLine = vTextLine;
+    vwCmd.bCmdYesValid = (vTextLine[0] == '-');
+    m_bInterpretDone = true;
+  }
+
+  int m_nReads;
+  volatile int m_nInterprets;
+  bool m_bEndOfInput;
+  int m_nInterpretDelayMs;
+  volatile bool m_bInterpretDone;
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<std::string> m_queueLines;
+  std::string m_strLine;
+};
+
+bool WaitForThreadEnd(CMIDriverCmdReader &vrReader) {
+  for (int i = 0; (i < 1000) && vrReader.ThreadIsActive(); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  return !vrReader.ThreadIsActive();
+}
+
+class TestMIDriverCmdReader : public ::testing::Test {
+protected:
+  void SetUp() override { ASSERT_TRUE(m_rReader.Initialize()); }
+  void TearDown() override {
+    EXPECT_TRUE(WaitForThreadEnd(m_rReader));
+    m_rReader.Shutdown();
+  }
+
+  CMIDriverCmdReader &m_rReader = CMIDriverCmdReader::Instance();
+};
+} // namespace
+
+TEST_F(TestMIDriverCmdReader, QueuesLinesInOrder) {
+  CFakeInput input;
+  input.Give("-exec-next");
+  input.Give("");
+  input.Give("bt");
+  input.End();
+  ASSERT_TRUE(m_rReader.StartThread(input));
+
+  CMIDriverCmdReader::SCmd cmd;
+  ASSERT_TRUE(m_rReader.Pop(cmd));
+  EXPECT_EQ("-exec-next", cmd.strMiTextLine);
+  EXPECT_TRUE(cmd.bCmdYesValid);
+  EXPECT_FALSE(cmd.bEndOfInput);
+  // Empty lines are not queued
+  ASSERT_TRUE(m_rReader.Pop(cmd));
+  EXPECT_EQ("bt", cmd.strMiTextLine);
+  EXPECT_FALSE(cmd.bCmdYesValid);
+  ASSERT_TRUE(m_rReader.Pop(cmd));
+  EXPECT_TRUE(cmd.bEndOfInput);
+  EXPECT_EQ(2, input.m_nInterprets);
+}
+
+TEST_F(TestMIDriverCmdReader, WakeUpWithNothingQueued) {
+  CFakeInput input;
+  ASSERT_TRUE(m_rReader.StartThread(input));
+  ASSERT_TRUE(input.WaitForReads(1));
+
+  m_rReader.WakeUp();
+  CMIDriverCmdReader::SCmd cmd;
+  EXPECT_FALSE(m_rReader.Pop(cmd));
+
+  input.End();
+  ASSERT_TRUE(m_rReader.Pop(cmd));
+  EXPECT_TRUE(cmd.bEndOfInput);
+}
+
+TEST_F(TestMIDriverCmdReader, LineReadAfterStopIsNotInterpreted) {
+  CFakeInput input;
+  ASSERT_TRUE(m_rReader.StartThread(input));
+  ASSERT_TRUE(input.WaitForReads(1));
+
+  // The driver stops the reader and shuts down while it waits for stdin
+  m_rReader.StopThread();
+  input.Give("-gdb-exit");
+  ASSERT_TRUE(WaitForThreadEnd(m_rReader));
+  EXPECT_EQ(0, input.m_nInterprets);
+  EXPECT_EQ(1, input.m_nReads);
+
+  m_rReader.WakeUp();
+  CMIDriverCmdReader::SCmd cmd;
+  EXPECT_FALSE(m_rReader.Pop(cmd));
+}
+
+TEST_F(TestMIDriverCmdReader, StopWaitsForLineBeingInterpreted) {
+  CFakeInput input;
+  input.m_nInterpretDelayMs = 50;
+  ASSERT_TRUE(m_rReader.StartThread(input));
+  input.Give("-exec-continue");
+  while (input.m_nInterprets == 0)
+    std::this_thread::yield();
+
+  m_rReader.StopThread();
+  EXPECT_TRUE(input.m_bInterpretDone);
+  // The reader may have gone on to wait for the next line, which is the end
+  // of input and not queued
+  input.End();
+  ASSERT_TRUE(WaitForThreadEnd(m_rReader));
+  EXPECT_EQ(1, input.m_nInterprets);
+
+  CMIDriverCmdReader::SCmd cmd;
+  ASSERT_TRUE(m_rReader.Pop(cmd));
+  EXPECT_EQ("-exec-continue", cmd.strMiTextLine);
+  m_rReader.WakeUp();
+  EXPECT_FALSE(m_rReader.Pop(cmd));
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <MIUtilCStringReader.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Memory readable from nBase to the end of vecBytes, logging each read
+struct SMemory {
+  SMemory(const MIuint64 vnBase, const size_t vnBytes)
+      : nBase(vnBase), vecBytes(vnBytes, 'x') {}
+
+  template <typename charT>
+  void Put(const MIuint64 vnAddr, const std::basic_string<charT> &vrText) {
+    ::memcpy(&vecBytes[vnAddr - nBase], vrText.c_str(),
+             (vrText.size() + 1) * sizeof(charT));
+  }
+
+  template <typename charT>
+  bool Read(const MIuint64 vnAddr, const MIuint64 vnMaxLen,
+            std::string &vwrText) {
+    const auto readFn = [this](const MIuint64 vnReadAddr, void *vpBuf,
+                               const size_t vnBytes) -> size_t {
+      vecReads.emplace_back(vnReadAddr, vnBytes);
+      const MIuint64 nEnd = nBase + vecBytes.size();
+      if ((vnReadAddr < nBase) || (vnReadAddr >= nEnd))
+        return 0;
+      const size_t nBytes =
+          std::min<size_t>(vnBytes, static_cast<size_t>(nEnd - vnReadAddr));
+      ::memcpy(vpBuf, &vecBytes[vnReadAddr - nBase], nBytes);
+      return nBytes;
+    };
+    return CMIUtilCStringReader<charT>::Read(vnAddr, vnMaxLen, readFn,
+                                             vwrText);
+  }
+
+  MIuint64 nBase;
+  std::vector<unsigned char> vecBytes;
+  std::vector<std::pair<MIuint64, size_t>> vecReads;
+};
+
+const MIuint64 kPage = CMIUtilCStringReader<char>::ms_nPageSize;
+} // namespace
+
+TEST(TestMIUtilCStringReader, ChunksEndAtPage) {
+  typedef CMIUtilCStringReader<char> Reader_t;
+  EXPECT_EQ(kPage, Reader_t::GetChunkBytes(kPage, 10 * kPage));
+  EXPECT_EQ(3u, Reader_t::GetChunkBytes(2 * kPage - 3, 10 * kPage));
+  EXPECT_EQ(5u, Reader_t::GetChunkBytes(kPage + 10, kPage + 15));
+
+  typedef CMIUtilCStringReader<char32_t> Reader32_t;
+  EXPECT_EQ(kPage - 4, Reader32_t::GetChunkBytes(kPage + 4, 10 * kPage));
+  // Characters across the end of the page are read on their own
+  EXPECT_EQ(4u, Reader32_t::GetChunkBytes(2 * kPage - 2, 10 * kPage));
+  EXPECT_EQ(4u, Reader32_t::GetChunkBytes(2 * kPage - 6, 10 * kPage));
+}
+
+TEST(TestMIUtilCStringReader, ReadsStringInOneRead) {
+  SMemory memory(kPage, kPage);
+  memory.Put<char>(kPage + 100, "hello");
+  std::string text;
+  EXPECT_TRUE(memory.Read<char>(kPage + 100, UINT32_MAX, text));
+  EXPECT_EQ("hello", text);
+  ASSERT_EQ(1u, memory.vecReads.size());
+  EXPECT_EQ(kPage + 100, memory.vecReads[0].first);
+  EXPECT_EQ(kPage - 100, memory.vecReads[0].second);
+}
+
+TEST(TestMIUtilCStringReader, ReadsAcrossPages) {
+  SMemory memory(kPage, 3 * kPage);
+  std::string strLong(kPage + 10, 'a');
+  memory.Put<char>(2 * kPage - 3, strLong);
+  std::string text;
+  EXPECT_TRUE(memory.Read<char>(2 * kPage - 3, UINT32_MAX, text));
+  EXPECT_EQ(strLong, text);
+  ASSERT_EQ(3u, memory.vecReads.size());
+  EXPECT_EQ(std::make_pair(2 * kPage - 3, size_t(3)), memory.vecReads[0]);
+  EXPECT_EQ(std::make_pair(2 * kPage, size_t(kPage)), memory.vecReads[1]);
+  EXPECT_EQ(std::make_pair(3 * kPage, size_t(kPage)), memory.vecReads[2]);
+}
+
+TEST(TestMIUtilCStringReader, StopsAtMaxLength) {
+  SMemory memory(kPage, kPage);
+  memory.Put<char>(kPage, "truncated");
+  std::string text;
+  EXPECT_TRUE(memory.Read<char>(kPage, 5, text));
+  EXPECT_EQ("trunc", text);
+  ASSERT_EQ(1u, memory.vecReads.size());
+  EXPECT_EQ(5u, memory.vecReads[0].second);
+}
+
+TEST(TestMIUtilCStringReader, UnreadableMemoryFails) {
+  // The string runs off the end of the readable page
+  SMemory memory(kPage, kPage);
+  memory.Put<char>(2 * kPage - 4, "abc");
+  memory.vecBytes.back() = 'd';
+  std::string text;
+  EXPECT_FALSE(memory.Read<char>(2 * kPage - 4, UINT32_MAX, text));
+  EXPECT_EQ(2u, memory.vecReads.size());
+
+  // A string ending before the unreadable page is never read past its page
+  memory.vecReads.clear();
+  memory.Put<char>(2 * kPage - 4, "abc");
+  text.clear();
+  EXPECT_TRUE(memory.Read<char>(2 * kPage - 4, UINT32_MAX, text));
+  EXPECT_EQ("abc", text);
+  EXPECT_EQ(1u, memory.vecReads.size());
+
+  // A short read without the null character
+  SMemory memoryShort(kPage, 10);
+  text.clear();
+  EXPECT_FALSE(memoryShort.Read<char>(kPage, UINT32_MAX, text));
+}
+
+TEST(TestMIUtilCStringReader, EscapesCharacters) {
+  SMemory memory(kPage, kPage);
+  memory.Put<char>(kPage, "a\"b\\c\n");
+  std::string text;
+  EXPECT_TRUE(memory.Read<char>(kPage, UINT32_MAX, text));
+  EXPECT_EQ("a\\\"b\\\\c\\n", text);
+
+  memory.Put<char16_t>(kPage, u"a\"\u00e9\n");
+  text.clear();
+  EXPECT_TRUE(memory.Read<char16_t>(kPage, UINT32_MAX, text));
+  EXPECT_EQ("a\\\"\\u00e9\\n", text);
+
+  memory.Put<char32_t>(kPage, U"\\\U0001f600z");
+  text.clear();
+  EXPECT_TRUE(memory.Read<char32_t>(kPage, UINT32_MAX, text));
+  EXPECT_EQ("\\\\\\U0001f600z", text);
+}
+
+TEST(TestMIUtilCStringReader, ReadsWideCharacterAcrossPage) {
+  SMemory memory(kPage, 2 * kPage);
+  memory.Put<char16_t>(2 * kPage - 1, u"ok");
+  std::string text;
+  EXPECT_TRUE(memory.Read<char16_t>(2 * kPage - 1, UINT32_MAX, text));
+  EXPECT_EQ("ok", text);
+  ASSERT_LE(2u, memory.vecReads.size());
+  EXPECT_EQ(std::make_pair(2 * kPage - 1, size_t(2)), memory.vecReads[0]);
+  EXPECT_EQ(std::make_pair(2 * kPage + 1, size_t(kPage - 2)),
+            memory.vecReads[1]);
+}
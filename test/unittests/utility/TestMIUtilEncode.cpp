@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <MIUtilEncode.h>
+
+#include <cstdint>
+#include <vector>
+
+TEST(TestMIUtilEncode, HexMatchesFormat) {
+  std::vector<unsigned char> data;
+  for (int i = 0; i < 300; ++i)
+    data.push_back(static_cast<unsigned char>(i * 7));
+  // Every length up to a few blocks so both the block and tail paths are hit
+  for (size_t nLen = 0; nLen <= data.size(); nLen += 13) {
+    CMIUtilString expected("prefix");
+    for (size_t i = 0; i < nLen; ++i)
+      expected += CMIUtilString::Format("%02hhx", data[i]);
+    CMIUtilString text("prefix");
+    CMIUtilEncode::AppendHex(text, data.data(), nLen);
+    EXPECT_EQ(expected, text);
+  }
+}
+
+TEST(TestMIUtilEncode, HexRoundTrips) {
+  std::vector<unsigned char> data(256);
+  for (int i = 0; i < 256; ++i)
+    data[i] = static_cast<unsigned char>(i);
+  CMIUtilString text;
+  CMIUtilEncode::AppendHex(text, data.data(), data.size());
+  std::vector<unsigned char> decoded(data.size());
+  EXPECT_TRUE(
+      CMIUtilEncode::DecodeHex(text.c_str(), text.size(), decoded.data()));
+  EXPECT_EQ(data, decoded);
+
+  unsigned char bytes[2] = {0, 0};
+  EXPECT_TRUE(CMIUtilEncode::DecodeHex("aBF0", 4, bytes));
+  EXPECT_EQ(0xab, bytes[0]);
+  EXPECT_EQ(0xf0, bytes[1]);
+}
+
+TEST(TestMIUtilEncode, HexRejectsBadText) {
+  unsigned char bytes[2];
+  EXPECT_FALSE(CMIUtilEncode::DecodeHex("abc", 3, bytes));
+  EXPECT_FALSE(CMIUtilEncode::DecodeHex("0g", 2, bytes));
+  EXPECT_FALSE(CMIUtilEncode::DecodeHex("-1", 2, bytes));
+  EXPECT_TRUE(CMIUtilEncode::DecodeHex("", 0, bytes));
+}
+
+TEST(TestMIUtilEncode, Base64RoundTrips) {
+  const unsigned char data[] = {'M', 'a', 'n', 0x00, 0xff, 0x10, 0x80};
+  const char *expected[] = {"",         "TQ==",     "TWE=",     "TWFu",
+                            "TWFuAA==", "TWFuAP8=", "TWFuAP8Q", "TWFuAP8QgA=="};
+  for (size_t nLen = 0; nLen <= sizeof(data); ++nLen) {
+    CMIUtilString text;
+    CMIUtilEncode::AppendBase64(text, data, nLen);
+    EXPECT_EQ(expected[nLen], text);
+    std::vector<unsigned char> decoded;
+    EXPECT_TRUE(
+        CMIUtilEncode::DecodeBase64(text.c_str(), text.size(), decoded));
+    EXPECT_EQ(std::vector<unsigned char>(data, data + nLen), decoded);
+  }
+
+  std::vector<unsigned char> decoded;
+  EXPECT_FALSE(CMIUtilEncode::DecodeBase64("TWF", 3, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeBase64("TW!u", 4, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeBase64("X===", 4, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeBase64("TWFu====", 8, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeBase64("TW=u", 4, decoded));
+}
+
+TEST(TestMIUtilEncode, RunLengthRoundTrips) {
+  std::vector<unsigned char> data = {1, 2, 3, 3, 3};
+  data.insert(data.end(), 4096, 0);
+  data.push_back(0xff);
+  CMIUtilString text;
+  CMIUtilEncode::AppendRunLength(text, data.data(), data.size());
+  EXPECT_EQ("0102030303" "00*4096;" "ff", text);
+  std::vector<unsigned char> decoded;
+  EXPECT_TRUE(
+      CMIUtilEncode::DecodeRunLength(text.c_str(), text.size(),
+                                     data.size(), decoded));
+  EXPECT_EQ(data, decoded);
+
+  // Plain hex is valid run length text
+  EXPECT_TRUE(CMIUtilEncode::DecodeRunLength("0a0b", 4, 16, decoded));
+  EXPECT_EQ(std::vector<unsigned char>({0x0a, 0x0b}), decoded);
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("*4;", 3, 16, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("00*4", 4, 16, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("00*0;", 5, 16, decoded));
+}
+
+TEST(TestMIUtilEncode, RunLengthDecodesNoMoreThanMaxSize) {
+  std::vector<unsigned char> decoded;
+  EXPECT_TRUE(CMIUtilEncode::DecodeRunLength("0a*3;0b", 7, 4, decoded));
+  EXPECT_EQ(std::vector<unsigned char>({0x0a, 0x0a, 0x0a, 0x0b}), decoded);
+
+  // The total is limited, not only each run
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("0a*3;0b", 7, 3, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("00*3;00*3;", 10, 5, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("0a0b0c", 6, 2, decoded));
+  EXPECT_FALSE(CMIUtilEncode::DecodeRunLength("00*99999999999999999999;", 24,
+                                              SIZE_MAX, decoded));
+}
+
+TEST(TestMIUtilEncode, EncodingNames) {
+  CMIUtilEncode::Encoding_e eEncoding;
+  EXPECT_TRUE(CMIUtilEncode::GetEncoding("base64", eEncoding));
+  EXPECT_EQ(CMIUtilEncode::eEncoding_Base64, eEncoding);
+  EXPECT_TRUE(CMIUtilEncode::GetEncoding("rle", eEncoding));
+  EXPECT_STREQ("rle", CMIUtilEncode::GetEncodingName(eEncoding));
+  EXPECT_FALSE(CMIUtilEncode::GetEncoding("lz4", eEncoding));
+}
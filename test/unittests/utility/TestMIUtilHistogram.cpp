@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <MIUtilHistogram.h>
+
+TEST(TestMIUtilHistogram, EmptyGivesZero) {
+  const CMIUtilHistogram histogram;
+  EXPECT_EQ(0ull, histogram.GetCount());
+  EXPECT_EQ(0ull, histogram.GetMax());
+  EXPECT_EQ(0ull, histogram.GetPercentile(50));
+}
+
+TEST(TestMIUtilHistogram, SmallValuesAreExact) {
+  CMIUtilHistogram histogram;
+  for (MIuint64 i = 1; i <= 10; ++i)
+    histogram.Add(i);
+  EXPECT_EQ(10ull, histogram.GetCount());
+  EXPECT_EQ(55ull, histogram.GetSum());
+  EXPECT_EQ(5ull, histogram.GetPercentile(50));
+  EXPECT_EQ(10ull, histogram.GetPercentile(99));
+  EXPECT_EQ(1ull, histogram.GetPercentile(0));
+}
+
+TEST(TestMIUtilHistogram, PercentilesWithinAnEighth) {
+  CMIUtilHistogram histogram;
+  for (MIuint64 i = 1; i <= 100000; ++i)
+    histogram.Add(i * 1000);
+  const MIuint64 nP50 = histogram.GetPercentile(50);
+  const MIuint64 nP99 = histogram.GetPercentile(99);
+  EXPECT_GE(nP50, 50000000ull);
+  EXPECT_LE(nP50, 50000000ull + 50000000ull / 8);
+  EXPECT_GE(nP99, 99000000ull);
+  EXPECT_LE(nP99, 100000000ull);
+  EXPECT_EQ(100000000ull, histogram.GetPercentile(100));
+  EXPECT_EQ(100000000ull, histogram.GetMax());
+}
+
+TEST(TestMIUtilHistogram, HandlesLargestValue) {
+  CMIUtilHistogram histogram;
+  histogram.Add(~0ull);
+  histogram.Add(1ull << 63);
+  EXPECT_EQ(~0ull, histogram.GetMax());
+  EXPECT_EQ(1ull << 63, histogram.GetPercentile(50) & (1ull << 63));
+  EXPECT_EQ(~0ull, histogram.GetPercentile(100));
+}
+
+TEST(TestMIUtilHistogram, ClearForgetsSamples) {
+  CMIUtilHistogram histogram;
+  histogram.Add(123456);
+  histogram.Clear();
+  EXPECT_EQ(0ull, histogram.GetCount());
+  EXPECT_EQ(0ull, histogram.GetPercentile(99));
+  histogram.Add(7);
+  EXPECT_EQ(7ull, histogram.GetPercentile(50));
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <MIUtilPerfectHash.h>
+
+#include <cstring>
+#include <string>
+
+namespace {
+struct SEntry {
+  const char *pName;
+  int nValue;
+};
+
+constexpr SEntry gEntries[] = {{"exec-next", 1},
+                               {"exec-step", 2},
+                               {"stack-list-frames", 3},
+                               {"var-update", 4},
+                               {"var-create", 5},
+                               {"thread", 6},
+                               {"thread-info", 7},
+                               {"info", 8}};
+constexpr CMIUtilPerfectHash<sizeof(gEntries) / sizeof(gEntries[0])>
+    gHash(gEntries);
+static_assert(gHash.IsValid(), "Entries are distinct");
+
+constexpr const char *gDuplicated[] = {"var-create", "var-update",
+                                       "var-create"};
+constexpr CMIUtilPerfectHash<3> gDuplicatedHash(gDuplicated);
+static_assert(!gDuplicatedHash.IsValid(), "Duplicate is found");
+} // namespace
+
+TEST(TestMIUtilPerfectHash, FindsEveryEntry) {
+  for (size_t i = 0; i < sizeof(gEntries) / sizeof(gEntries[0]); ++i)
+    EXPECT_EQ(static_cast<int>(i),
+              gHash.Find(gEntries[i].pName, ::strlen(gEntries[i].pName)));
+}
+
+TEST(TestMIUtilPerfectHash, RejectsOtherNames) {
+  const char *const apOthers[] = {"",          "exec",       "exec-next ",
+                                  "exec-nexT", "thread-inf", "var-updates",
+                                  "gdb-exit",  "infoo"};
+  for (const char *pOther : apOthers)
+    EXPECT_EQ(-1, gHash.Find(pOther, ::strlen(pOther))) << pOther;
+}
+
+TEST(TestMIUtilPerfectHash, UsesLengthNotTerminator) {
+  const std::string strLine("thread-info --thread 1");
+  EXPECT_EQ(5, gHash.Find(strLine.c_str(), 6));
+  EXPECT_EQ(6, gHash.Find(strLine.c_str(), 11));
+}
+
+TEST(TestMIUtilPerfectHash, BuildsLargeTables) {
+  static constexpr const char *apNames[] = {
+      "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "a9", "b0",
+      "b1", "b2", "b3", "b4", "b5", "b6", "b7", "b8", "b9", "c0", "c1",
+      "c2", "c3", "c4", "c5", "c6", "c7", "c8", "c9", "d0", "d1", "d2",
+      "d3", "d4", "d5", "d6", "d7", "d8", "d9", "e0", "e1", "e2", "e3",
+      "e4", "e5", "e6", "e7", "e8", "e9", "f0", "f1", "f2", "f3", "f4",
+      "f5", "f6", "f7", "f8", "f9", "g0", "g1", "g2", "g3", "g4", "g5"};
+  constexpr CMIUtilPerfectHash<sizeof(apNames) / sizeof(apNames[0])> hash(
+      apNames);
+  static_assert(hash.IsValid(), "Names are distinct");
+  for (size_t i = 0; i < sizeof(apNames) / sizeof(apNames[0]); ++i)
+    EXPECT_EQ(static_cast<int>(i), hash.Find(apNames[i], 2));
+  EXPECT_EQ(-1, hash.Find("g6", 2));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <MIUtilString.h>
+
+TEST(TestMIUtilString, FormatTypedMatchesPrintf) {
+  const MIuint64 addr = 0x7fff5fbff8a0;
+  EXPECT_EQ(CMIUtilString::Format("0x%016" PRIx64, addr),
+            CMIUtilString::FormatTyped("0x%016" PRIx64, addr));
+  EXPECT_EQ(CMIUtilString::Format("%d", -42),
+            CMIUtilString::FormatTyped("%d", -42));
+  EXPECT_EQ(CMIUtilString::Format("%u", 4000000000u),
+            CMIUtilString::FormatTyped("%u", 4000000000u));
+  EXPECT_EQ(CMIUtilString::Format("%lld", -9000000000ll),
+            CMIUtilString::FormatTyped("%lld", -9000000000ll));
+  EXPECT_EQ(CMIUtilString::Format("%02hhx", 0xab),
+            CMIUtilString::FormatTyped("%02hhx",
+                                       static_cast<unsigned char>(0xab)));
+  EXPECT_EQ(CMIUtilString::Format("[%-6s|%6s|%.2s]", "ab", "cd", "efgh"),
+            CMIUtilString::FormatTyped("[%-6s|%6s|%.2s]", "ab", "cd", "efgh"));
+  EXPECT_EQ(CMIUtilString::Format("%+5d|%-5d|%05d|%.3d", 7, 7, -7, 7),
+            CMIUtilString::FormatTyped("%+5d|%-5d|%05d|%.3d", 7, 7, -7, 7));
+  EXPECT_EQ(CMIUtilString::Format("%#x|%#o|%X|%c|100%%", 255, 8, 0xbeef, 'z'),
+            CMIUtilString::FormatTyped("%#x|%#o|%X|%c|100%%", 255, 8, 0xbeef,
+                                       'z'));
+  EXPECT_EQ(CMIUtilString::Format("%.3f|%g", 3.14159, 0.5),
+            CMIUtilString::FormatTyped("%.3f|%g", 3.14159, 0.5));
+  EXPECT_EQ(CMIUtilString::Format("%hd", 70000),
+            CMIUtilString::FormatTyped("%hd", 70000));
+  // Without a length modifier the value is taken as an int, like printf
+  EXPECT_EQ(CMIUtilString::Format("%d", UINT32_MAX),
+            CMIUtilString::FormatTyped("%d", UINT32_MAX));
+}
+
+TEST(TestMIUtilString, FormatTypedTakesStringsDirectly) {
+  const CMIUtilString parent("var1");
+  const std::string member("field");
+  EXPECT_EQ("var1.field", CMIUtilString::FormatTyped("%s.%s", parent, member));
+  EXPECT_EQ("var1.$3", CMIUtilString::FormatTyped("%s.$%u", parent, 3u));
+  EXPECT_EQ("(null)", CMIUtilString::FormatTyped("%s", (const char *)nullptr));
+}
+
+// A mismatch asserts in a debug build and is marked in the text otherwise
+TEST(TestMIUtilString, FormatTypedMarksTooFewArguments) {
+  CMIUtilString text;
+  EXPECT_DEBUG_DEATH(text = CMIUtilString::FormatTyped("a=%d,b=%s", 1), "");
+#ifdef NDEBUG
+  EXPECT_EQ("a=1,b=%!s(MISSING)", text);
+#endif
+}
+
+TEST(TestMIUtilString, FormatTypedMarksTooManyArguments) {
+  CMIUtilString text;
+  EXPECT_DEBUG_DEATH(text = CMIUtilString::FormatTyped("a=%d", 1, 2), "");
+#ifdef NDEBUG
+  EXPECT_EQ("a=1%!(EXTRA)", text);
+#endif
+}
+
+TEST(TestMIUtilString, FormatTypedMarksWrongType) {
+  CMIUtilString text;
+  EXPECT_DEBUG_DEATH(text = CMIUtilString::FormatTyped("%s|%d", 12, "x"), "");
+#ifdef NDEBUG
+  EXPECT_EQ("%!s(BADTYPE)|%!d(BADTYPE)", text);
+#endif
+}
+
+TEST(TestMIUtilString, AppendFormatAppends) {
+  CMIUtilString text("level=");
+  text.AppendFormat("%d", 3).AppendFormat(",addr=0x%016" PRIx64, 0x400000ull);
+  EXPECT_EQ("level=3,addr=0x0000000000400000", text);
+}
+
+TEST(TestMIUtilString, FormatHandlesLongOutput) {
+  const std::string big(1000, 'x');
+  const CMIUtilString text(CMIUtilString::Format("<%s>", big.c_str()));
+  EXPECT_EQ(1002u, text.size());
+  EXPECT_EQ("<" + big + ">", text);
+}
+
+TEST(TestMIUtilString, EscapeKeepsPlainText) {
+  const CMIUtilString text("a plain line of text longer than sixteen bytes");
+  EXPECT_EQ(text, text.Escape());
+  EXPECT_EQ(text, text.AddSlashes());
+}
+
+TEST(TestMIUtilString, EscapeFormsSequences) {
+  const CMIUtilString text("tab\there \"q\" back\\slash\x01\x7f\xe9 end\a\033");
+  EXPECT_EQ("tab\\there \"q\" back\\\\slash\\x01\\x7f\\xffffffe9 end\\a\\e",
+            text.Escape());
+  EXPECT_EQ(
+      "tab\\there \\\"q\\\" back\\\\slash\\x01\\x7f\\xffffffe9 end\\a\\e",
+      text.Escape(true));
+  EXPECT_EQ("tab\there \\\"q\\\" back\\\\slash\x01\x7f\xe9 end\a\033",
+            text.AddSlashes());
+}
+
+TEST(TestMIUtilString, EscapeAndAddSlashesMatchesBothSteps) {
+  std::string text;
+  for (int i = 0; i < 3; ++i)
+    for (int c = 0; c < 256; ++c)
+      text.push_back(static_cast<char>(c));
+  const CMIUtilString value(text);
+  EXPECT_EQ(value.Escape().AddSlashes(), value.EscapeAndAddSlashes());
+  for (int c = 0; c < 256; ++c) {
+    const char ch = static_cast<char>(c);
+    EXPECT_EQ(CMIUtilString(std::string(1, ch)).Escape(true),
+              CMIUtilString::ConvertToPrintableASCII(ch, true));
+  }
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <MICmnMIValueArena.h>
+
+TEST(TestMICmnMIValueArena, ReusesReleasedBuffers) {
+  CMICmnMIValueArena arena;
+  const CMICmnMIValueArena::CScope scope(&arena);
+
+  CMIUtilString first(std::string(200, 'x'));
+  const char *pBuffer = first.data();
+  CMICmnMIValueArena::Release(first);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(1u, arena.GetSpareCount());
+
+  CMIUtilString second;
+  CMICmnMIValueArena::Acquire(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(pBuffer, second.data());
+  EXPECT_GE(second.capacity(), 200u);
+  EXPECT_EQ(0u, arena.GetSpareCount());
+  EXPECT_EQ(1u, arena.GetReuseCount());
+}
+
+TEST(TestMICmnMIValueArena, DoesNothingWithoutCurrentArena) {
+  CMICmnMIValueArena arena;
+  {
+    const CMICmnMIValueArena::CScope scope(&arena);
+  }
+
+  CMIUtilString text(std::string(200, 'x'));
+  CMICmnMIValueArena::Release(text);
+  EXPECT_EQ(200u, text.size());
+  EXPECT_EQ(0u, arena.GetSpareCount());
+
+  // Short text has no buffer worth keeping
+  const CMICmnMIValueArena::CScope scope(&arena);
+  CMIUtilString shortText("x");
+  CMICmnMIValueArena::Release(shortText);
+  EXPECT_EQ(0u, arena.GetSpareCount());
+}
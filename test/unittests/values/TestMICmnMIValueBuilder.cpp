@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <MICmnMIValueBuilder.h>
+
+TEST(TestMICmnMIValueBuilder, BuildsNestedListsAndTuples) {
+  CMIUtilString text;
+  CMICmnMIValueBuilder builder(text);
+
+  builder.Result("stack");
+  builder.OpenList();
+  for (int i = 0; i < 2; i++) {
+    builder.Result("frame");
+    builder.OpenTuple();
+    builder.Result("level");
+    builder.Const(CMIUtilString::Format("%d", i));
+    builder.Result("addr");
+    builder.Const("0x0");
+    builder.CloseTuple();
+  }
+  builder.CloseList();
+  builder.Result("empty");
+  builder.OpenTuple();
+  builder.CloseTuple();
+
+  EXPECT_EQ("stack=[frame={level=\"0\",addr=\"0x0\"},"
+            "frame={level=\"1\",addr=\"0x0\"}],empty={}",
+            text);
+}
+
+TEST(TestMICmnMIValueBuilder, ReopensClosedListOrTuple) {
+  CMIUtilString text("[]");
+  CMICmnMIValueBuilder builder(text);
+
+  EXPECT_TRUE(builder.Reopen());
+  builder.Value("a");
+  builder.CloseList();
+  EXPECT_EQ("[a]", text);
+
+  EXPECT_TRUE(builder.Reopen());
+  builder.Value("b");
+  builder.CloseList();
+  EXPECT_EQ("[a,b]", text);
+
+  CMIUtilString tuple("{x=\"1\"}");
+  CMICmnMIValueBuilder spaced(tuple, true);
+  EXPECT_TRUE(spaced.Reopen());
+  spaced.Result("y");
+  spaced.Const("2");
+  spaced.CloseTuple();
+  EXPECT_EQ("{x=\"1\", y = \"2\"}", tuple);
+
+  CMIUtilString notContainer("a=\"1\"");
+  CMICmnMIValueBuilder other(notContainer);
+  EXPECT_FALSE(other.Reopen());
+}
+
+TEST(TestMICmnMIValueBuilder, FormsConstLikeMIValueConst) {
+  CMIUtilString text;
+  CMICmnMIValueBuilder builder(text);
+
+  builder.OpenList();
+  builder.Const("");
+  builder.Const("", true);
+  builder.Const("line\ndropped");
+  builder.Const("raw", true);
+  builder.CloseList();
+
+  EXPECT_EQ("[\"\",\"\",\"line\",raw]", text);
+}